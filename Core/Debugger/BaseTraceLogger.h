@@ -463,6 +463,7 @@ public:
 		_options = options;
 
 		_enabled = options.Enabled;
+		_debugger->UpdateHookFlags();
 
 		string condition = _options.Condition;
 		string format = _options.Format;
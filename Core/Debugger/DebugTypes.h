@@ -471,6 +471,19 @@ struct CpuInstructionProgress
 	MemoryOperationInfo LastMemOperation = {};
 };
 
+//Debugger features that need the full memory read/write hooks - when none are active,
+//the CPU debuggers only update the CDL (and the other tools are skipped entirely)
+enum class DebuggerHookFlags : uint32_t
+{
+	None = 0,
+	DebuggerWindow = (1 << 0),
+	Breakpoints = (1 << 1),
+	TraceLogger = (1 << 2),
+	AccessCounters = (1 << 3),
+	EventViewer = (1 << 4),
+	Scripts = (1 << 5),
+};
+
 struct DebugControllerState
 {
 	bool A;
@@ -100,6 +100,7 @@ Debugger::Debugger(Emulator* emu, IConsole* console)
 		_debuggers[(int)type].Debugger->Init();
 		_debuggers[(int)type].Debugger->ProcessConfigChange();
 	}
+	UpdateHookFlags();
 
 	_breakRequestCount = 0;
 	_suspendRequestCount = 0;
@@ -183,6 +184,12 @@ bool Debugger::ProcessStepBack(IDebugger* debugger)
 	}
 }
 
+bool Debugger::IsCdlOnly(IDebugger* debugger)
+{
+	//Break requests are processed by the full hooks
+	return debugger->IsCdlOnly() && !_breakRequestCount && !_waitForBreakResume;
+}
+
 template<CpuType type>
 void Debugger::ProcessInstruction()
 {
@@ -223,11 +230,29 @@ void Debugger::ProcessInstruction()
 template<CpuType type, MemoryAccessFlags flags, typename T>
 void Debugger::ProcessMemoryRead(uint32_t addr, T& value, MemoryOperationType opType)
 {
-	if(_debuggers[(int)type].Debugger->IsStepBack()) {
+	IDebugger* debugger = _debuggers[(int)type].Debugger.get();
+	if(debugger->IsStepBack()) {
 		SleepOnBreakRequest<type>();
 		return;
 	}
 
+	if(IsCdlOnly(debugger)) {
+		//No tool needs the full hooks, only update the CDL
+		switch(type) {
+			case CpuType::Snes: GetDebugger<CpuType::Snes, SnesDebugger>()->ProcessCdlRead(addr, value, opType); break;
+			case CpuType::Spc: GetDebugger<CpuType::Spc, SpcDebugger>()->ProcessCdlRead(addr, value, opType); break;
+			case CpuType::NecDsp: GetDebugger<CpuType::NecDsp, NecDspDebugger>()->ProcessRead(addr, value, opType); break;
+			case CpuType::Sa1: GetDebugger<CpuType::Sa1, SnesDebugger>()->ProcessCdlRead(addr, value, opType); break;
+			case CpuType::Gsu: GetDebugger<CpuType::Gsu, GsuDebugger>()->ProcessCdlRead(addr, value, opType); break;
+			case CpuType::Cx4: GetDebugger<CpuType::Cx4, Cx4Debugger>()->ProcessRead(addr, value, opType); break;
+			case CpuType::Gameboy: GetDebugger<CpuType::Gameboy, GbDebugger>()->ProcessCdlRead(addr, value, opType); break;
+			case CpuType::Nes: GetDebugger<CpuType::Nes, NesDebugger>()->ProcessCdlRead(addr, value, opType); break;
+			case CpuType::Pce: GetDebugger<CpuType::Pce, PceDebugger>()->ProcessCdlRead(addr, value, opType); break;
+			case CpuType::Sms: GetDebugger<CpuType::Sms, SmsDebugger>()->ProcessCdlRead(addr, value, opType); break;
+		}
+		return;
+	}
+
 	switch(type) {
 		case CpuType::Snes: GetDebugger<CpuType::Snes, SnesDebugger>()->ProcessRead(addr, value, opType); break;
 		case CpuType::Spc: GetDebugger<CpuType::Spc, SpcDebugger>()->ProcessRead<flags>(addr, value, opType); break;
@@ -249,11 +274,28 @@ void Debugger::ProcessMemoryRead(uint32_t addr, T& value, MemoryOperationType op
 template<CpuType type, MemoryAccessFlags flags, typename T>
 bool Debugger::ProcessMemoryWrite(uint32_t addr, T& value, MemoryOperationType opType)
 {
-	if(_debuggers[(int)type].Debugger->IsStepBack()) {
+	IDebugger* debugger = _debuggers[(int)type].Debugger.get();
+	if(debugger->IsStepBack()) {
 		SleepOnBreakRequest<type>();
 		return true;
 	}
 
+	if(IsCdlOnly(debugger)) {
+		switch(type) {
+			case CpuType::Snes: GetDebugger<CpuType::Snes, SnesDebugger>()->ProcessCdlWrite(addr, value, opType); break;
+			case CpuType::Spc: GetDebugger<CpuType::Spc, SpcDebugger>()->ProcessCdlWrite(addr, value, opType); break;
+			case CpuType::NecDsp: GetDebugger<CpuType::NecDsp, NecDspDebugger>()->ProcessWrite(addr, value, opType); break;
+			case CpuType::Sa1: GetDebugger<CpuType::Sa1, SnesDebugger>()->ProcessCdlWrite(addr, value, opType); break;
+			case CpuType::Gsu: GetDebugger<CpuType::Gsu, GsuDebugger>()->ProcessCdlWrite(addr, value, opType); break;
+			case CpuType::Cx4: GetDebugger<CpuType::Cx4, Cx4Debugger>()->ProcessWrite(addr, value, opType); break;
+			case CpuType::Gameboy: GetDebugger<CpuType::Gameboy, GbDebugger>()->ProcessCdlWrite(addr, value, opType); break;
+			case CpuType::Nes: GetDebugger<CpuType::Nes, NesDebugger>()->ProcessCdlWrite(addr, value, opType); break;
+			case CpuType::Pce: GetDebugger<CpuType::Pce, PceDebugger>()->ProcessCdlWrite(addr, value, opType); break;
+			case CpuType::Sms: GetDebugger<CpuType::Sms, SmsDebugger>()->ProcessCdlWrite(addr, value, opType); break;
+		}
+		return !debugger->GetFrozenAddressManager().IsFrozenAddress(addr);
+	}
+
 	switch(type) {
 		case CpuType::Snes: GetDebugger<CpuType::Snes, SnesDebugger>()->ProcessWrite(addr, value, opType); break;
 		case CpuType::Spc: GetDebugger<CpuType::Spc, SpcDebugger>()->ProcessWrite<flags>(addr, value, opType); break;
@@ -271,7 +313,7 @@ bool Debugger::ProcessMemoryWrite(uint32_t addr, T& value, MemoryOperationType o
 		ProcessScripts<type>(addr, value, opType);
 	}
 	
-	return !_debuggers[(int)type].Debugger->GetFrozenAddressManager().IsFrozenAddress(addr);
+	return !debugger->GetFrozenAddressManager().IsFrozenAddress(addr);
 }
 
 template<CpuType cpuType, MemoryType memType, MemoryOperationType opType, typename T>
@@ -279,17 +321,19 @@ void Debugger::ProcessMemoryAccess(uint32_t addr, T& value)
 {
 	IDebugger* debugger = _debuggers[(int)cpuType].Debugger.get();
 
-	if(debugger->IsStepBack()) {
+	if(debugger->IsStepBack() || IsCdlOnly(debugger)) {
 		return;
 	}
 
 	AddressInfo addressInfo = { (int32_t)addr, memType };
 	MemoryOperationInfo operation(addr, value, opType, memType);
 
-	if constexpr(opType == MemoryOperationType::Write) {
-		_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _emu->GetMasterClock());
-	} else {
-		_memoryAccessCounter->ProcessMemoryRead(addressInfo, _emu->GetMasterClock());
+	if(debugger->CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+		if constexpr(opType == MemoryOperationType::Write) {
+			_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _emu->GetMasterClock());
+		} else {
+			_memoryAccessCounter->ProcessMemoryRead(addressInfo, _emu->GetMasterClock());
+		}
 	}
 
 	switch(cpuType) {
@@ -562,6 +606,45 @@ void Debugger::ProcessConfigChange()
 			_debuggers[i].Debugger->ProcessConfigChange();
 		}
 	}
+	UpdateHookFlags();
+}
+
+void Debugger::UpdateHookFlags()
+{
+	//Select which memory hooks each CPU debugger runs, based on the tools that are currently in use
+	bool hasScripts = _scriptManager->HasScript();
+	bool accessCounters = _settings->CheckDebuggerFlag(DebuggerFlags::AccessCountersEnabled);
+	bool eventViewer = _settings->CheckDebuggerFlag(DebuggerFlags::EventViewerEnabled);
+
+	for(int i = 0; i <= (int)DebugUtilities::GetLastCpuType(); i++) {
+		IDebugger* debugger = _debuggers[i].Debugger.get();
+		if(!debugger) {
+			continue;
+		}
+
+		uint32_t flags = (uint32_t)DebuggerHookFlags::None;
+		if(IsDebugWindowOpened((CpuType)i)) {
+			//The debugger window's tooltips and "break on uninitialized read" option use the access counters
+			flags |= (uint32_t)DebuggerHookFlags::DebuggerWindow | (uint32_t)DebuggerHookFlags::AccessCounters;
+		}
+		if(debugger->GetBreakpointManager()->HasBreakpoints()) {
+			flags |= (uint32_t)DebuggerHookFlags::Breakpoints;
+		}
+		if(debugger->GetTraceLogger()->IsEnabled()) {
+			flags |= (uint32_t)DebuggerHookFlags::TraceLogger;
+		}
+		if(accessCounters) {
+			flags |= (uint32_t)DebuggerHookFlags::AccessCounters;
+		}
+		if(eventViewer) {
+			flags |= (uint32_t)DebuggerHookFlags::EventViewer;
+		}
+		if(hasScripts) {
+			//Scripts can read the access counters at any time
+			flags |= (uint32_t)DebuggerHookFlags::Scripts | (uint32_t)DebuggerHookFlags::AccessCounters;
+		}
+		debugger->SetHookFlags((DebuggerHookFlags)flags);
+	}
 }
 
 void Debugger::GetTokenList(CpuType cpuType, char* tokenList)
@@ -890,6 +973,7 @@ void Debugger::SetBreakpoints(Breakpoint breakpoints[], uint32_t length)
 			_debuggers[i].Debugger->GetBreakpointManager()->SetBreakpoints(breakpoints, length);
 		}
 	}
+	UpdateHookFlags();
 }
 
 void Debugger::SetInputOverrides(uint32_t index, DebugControllerState state)
@@ -95,6 +95,8 @@ private:
 	template<CpuType type, typename T> void ProcessScripts(uint32_t addr, T& value, MemoryOperationType opType);
 	template<CpuType type, typename T> void ProcessScripts(uint32_t addr, T& value, MemoryType memType, MemoryOperationType opType);
 	
+	__forceinline bool IsCdlOnly(IDebugger* debugger);
+
 	bool IsDebugWindowOpened(CpuType cpuType);
 	bool IsBreakOptionEnabled(BreakSource src);
 	template<CpuType type> void SleepOnBreakRequest();
@@ -122,6 +124,7 @@ public:
 	void ProcessEvent(EventType type, std::optional<CpuType> cpuType);
 
 	void ProcessConfigChange();
+	void UpdateHookFlags();
 
 	void GetTokenList(CpuType cpuType, char* tokenList);
 	int32_t EvaluateExpression(string expression, CpuType cpuType, EvalResultType &resultType, bool useCache);
@@ -38,7 +38,9 @@ Disassembler::Disassembler(IConsole* console, Debugger* debugger)
 void Disassembler::InitSource(MemoryType type)
 {
 	uint32_t size = _memoryDumper->GetMemorySize(type);
-	_sources[(int)type] = { vector<DisassemblyInfo>(size), size };
+	uint32_t blockCount = (size + (1 << DisassemblerSource::BlockShift) - 1) >> DisassemblerSource::BlockShift;
+	_sources[(int)type] = { vector<DisassemblyInfo>(size), vector<uint32_t>(blockCount), size };
+	_sourceGeneration++;
 }
 
 DisassemblerSource& Disassembler::GetSource(MemoryType type)
@@ -56,6 +58,7 @@ uint32_t Disassembler::BuildCache(AddressInfo &addrInfo, uint8_t cpuFlags, CpuTy
 		DisassemblyInfo &disInfo = src.Cache[address];
 		if(!disInfo.IsInitialized() || !disInfo.IsValid(cpuFlags)) {
 			disInfo.Initialize(address, cpuFlags, type, addrInfo.Type, _memoryDumper);
+			src.BlockVersions[address >> DisassemblerSource::BlockShift]++;
 			for(int i = 1; i < disInfo.GetOpSize() && address + i < src.Cache.size() ; i++) {
 				//Clear any instructions that start in the middle of this one
 				//(can happen when resizing an instruction after X/M updates)
@@ -94,6 +97,7 @@ void Disassembler::InvalidateCache(AddressInfo addrInfo, CpuType type)
 		for(int i = 0; i < 4; i++) {
 			if(addrInfo.Address >= i) {
 				src.Cache[addrInfo.Address - i].Reset();
+				src.BlockVersions[(addrInfo.Address - i) >> DisassemblerSource::BlockShift]++;
 			}
 		}
 	}
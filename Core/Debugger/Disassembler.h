@@ -16,7 +16,11 @@ enum class CpuType : uint8_t;
 
 struct DisassemblerSource
 {
+	//Each block of (1 << BlockShift) bytes has a version that changes whenever the disassembly for that block changes
+	static constexpr int BlockShift = 12;
+
 	vector<DisassemblyInfo> Cache;
+	vector<uint32_t> BlockVersions;
 	uint32_t Size = 0;
 };
 
@@ -32,6 +36,7 @@ private:
 	MemoryDumper *_memoryDumper;
 
 	DisassemblerSource _sources[DebugUtilities::GetMemoryTypeCount()] = {};
+	uint32_t _sourceGeneration = 0;
 	
 	void InitSource(MemoryType type);
 	DisassemblerSource& GetSource(MemoryType type);
@@ -63,4 +68,13 @@ public:
 
 	uint32_t GetDisassemblyOutput(CpuType type, uint32_t address, CodeLineData output[], uint32_t rowCount);
 	int32_t GetDisassemblyRowAddress(CpuType type, uint32_t address, int32_t rowOffset);
+
+	//Used by the search index to detect changes to the disassembly cache
+	uint32_t GetSourceGeneration() { return _sourceGeneration; }
+	uint32_t GetBlockVersion(MemoryType type, int32_t address)
+	{
+		DisassemblerSource& src = GetSource(type);
+		uint32_t block = (uint32_t)address >> DisassemblerSource::BlockShift;
+		return block < src.BlockVersions.size() ? src.BlockVersions[block] : 0;
+	}
 };
\ No newline at end of file
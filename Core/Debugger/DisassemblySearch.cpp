@@ -2,6 +2,14 @@
 #include "Debugger/Disassembler.h"
 #include "Debugger/DisassemblySearch.h"
 #include "Debugger/LabelManager.h"
+#include "Debugger/Debugger.h"
+#include "Debugger/MemoryDumper.h"
+#include "Debugger/CdlManager.h"
+#include "Debugger/CodeDataLogger.h"
+#include "Shared/EmuSettings.h"
+#include "Shared/Interfaces/IConsole.h"
+#include "SNES/SnesCpuTypes.h"
+#include "Utilities/HexUtilities.h"
 
 DisassemblySearch::DisassemblySearch(Disassembler* disassembler, LabelManager* labelManager)
 {
@@ -13,12 +21,241 @@ int32_t DisassemblySearch::SearchDisassembly(CpuType cpuType, const char* search
 {
 	CodeLineData results[1] = {};
 	uint32_t resultCount = SearchDisassembly(cpuType, searchString, startAddress, options, results, 1);
+	EvictBanks();
 	return resultCount > 0 ? results[0].Address : -1;
 }
 
 uint32_t DisassemblySearch::FindOccurrences(CpuType cpuType, const char* searchString, DisassemblySearchOptions options, CodeLineData output[], uint32_t maxResultCount)
 {
-	return SearchDisassembly(cpuType, searchString, 0, options, output, maxResultCount);
+	uint32_t resultCount = SearchDisassembly(cpuType, searchString, 0, options, output, maxResultCount);
+	EvictBanks();
+	return resultCount;
+}
+
+uint32_t DisassemblySearch::GetTrigram(char a, char b, char c)
+{
+	uint32_t value = (uint8_t)tolower(a) | ((uint8_t)tolower(b) << 8) | ((uint8_t)tolower(c) << 16);
+	return (value * 2654435761u) >> 20;
+}
+
+uint32_t DisassemblySearch::GetConfigFlags()
+{
+	DebugConfig& cfg = _disassembler->_settings->GetDebugConfig();
+	return (
+		(cfg.ShowJumpLabels ? 0x01 : 0) |
+		(cfg.ShowVerifiedData ? 0x02 : 0) |
+		(cfg.DisassembleVerifiedData ? 0x04 : 0) |
+		(cfg.ShowUnidentifiedData ? 0x08 : 0) |
+		(cfg.DisassembleUnidentifiedData ? 0x10 : 0) |
+		(cfg.UseLowerCaseDisassembly ? 0x20 : 0) |
+		(cfg.SnesUseAltSpcOpNames ? 0x40 : 0)
+	);
+}
+
+int32_t DisassemblySearch::GetCpuFlags(CpuType cpuType)
+{
+	//Instructions that haven't been executed yet are disassembled using the CPU's current M/X flags
+	if(cpuType == CpuType::Snes || cpuType == CpuType::Sa1) {
+		SnesCpuState& state = (SnesCpuState&)_disassembler->_debugger->GetCpuStateRef(cpuType);
+		return state.PS & (ProcFlags::MemoryMode8 | ProcFlags::IndexMode8);
+	}
+	return 0;
+}
+
+uint64_t DisassemblySearch::GetMemoryKey(CpuType cpuType, uint16_t bank)
+{
+	//Combines the memory mappings, the CDL flags and the disassembly cache's block versions for the bank
+	//The mappings are sampled every 256 bytes, which is smaller than the mapping granularity of all supported consoles
+	constexpr int32_t pageSize = 0x100;
+	constexpr uint64_t prime = 0x100000001B3;
+
+	MemoryType memType = DebugUtilities::GetCpuMemoryType(cpuType);
+	int32_t bankStart = bank << 16;
+	int32_t bankEnd = std::min<int32_t>((bank + 1) << 16, (int32_t)_disassembler->_memoryDumper->GetMemorySize(memType));
+	CdlManager* cdlManager = _disassembler->_debugger->GetCdlManager();
+
+	uint64_t key = 0xCBF29CE484222325;
+	AddressInfo relAddress = { 0, memType };
+	for(int32_t addr = bankStart; addr < bankEnd; addr += pageSize) {
+		relAddress.Address = addr;
+		AddressInfo absAddress = _disassembler->_console->GetAbsoluteAddress(relAddress);
+		key = (key ^ (uint64_t)absAddress.Address) * prime;
+		key = (key ^ (uint64_t)absAddress.Type) * prime;
+		if(absAddress.Address < 0) {
+			continue;
+		}
+
+		key = (key ^ _disassembler->GetBlockVersion(absAddress.Type, absAddress.Address)) * prime;
+
+		CodeDataLogger* cdl = cdlManager->GetCodeDataLogger(absAddress.Type);
+		if(cdl && (uint32_t)absAddress.Address < cdl->GetSize()) {
+			uint8_t* cdlData = cdl->GetRawData() + absAddress.Address;
+			uint32_t size = std::min<uint32_t>(pageSize, cdl->GetSize() - absAddress.Address);
+			uint32_t i = 0;
+			for(; i + 8 <= size; i += 8) {
+				uint64_t value;
+				memcpy(&value, cdlData + i, sizeof(value));
+				key = (key ^ value) * prime;
+			}
+			for(; i < size; i++) {
+				key = (key ^ cdlData[i]) * prime;
+			}
+		}
+	}
+	return key;
+}
+
+void DisassemblySearch::BuildBank(DisassemblySearchBank& entry, CpuType cpuType, uint16_t bank)
+{
+	MemoryType memType = DebugUtilities::GetCpuMemoryType(cpuType);
+	DebugConfig& cfg = _disassembler->_settings->GetDebugConfig();
+	bool disassembleData = cfg.DisassembleUnidentifiedData || cfg.DisassembleVerifiedData;
+
+	entry.Rows = _disassembler->Disassemble(cpuType, bank);
+	entry.RowInfo.clear();
+	entry.RowInfo.reserve(entry.Rows.size());
+	entry.Text.clear();
+	entry.Trigrams.reset();
+	entry.Volatile = false;
+	entry.UsesCpuFlags = false;
+
+	CodeLineData lineData = {};
+	for(DisassemblyResult& row : entry.Rows) {
+		DisassemblySearchBank::RowText info = {};
+		info.Offset = (uint32_t)entry.Text.size();
+
+		bool isBlockStartEnd = (row.Flags & (LineFlags::BlockStart | LineFlags::BlockEnd | LineFlags::Empty)) != 0;
+		bool isRam = row.Address.Address >= 0 && !DebugUtilities::IsRom(row.Address.Type);
+		bool isInstruction = !isBlockStartEnd && row.Address.Address >= 0 && !(row.Flags & (LineFlags::ShowAsData | LineFlags::Label)) && !((row.Flags & LineFlags::Comment) && row.CommentLine >= 0);
+
+		if(isInstruction) {
+			info.Flags |= DisassemblySearchBank::Instruction;
+
+			DisassemblyInfo& disInfo = _disassembler->GetSource(row.Address.Type).Cache[row.Address.Address];
+			if(!disInfo.IsInitialized()) {
+				if(isRam) {
+					//Code that was disassembled from the content of RAM
+					entry.Volatile = true;
+				}
+				entry.UsesCpuFlags = true;
+			}
+		}
+
+		if(isRam && (row.Flags & LineFlags::ShowAsData)) {
+			info.Flags |= DisassemblySearchBank::LiveText;
+		} else if(isRam && !isBlockStartEnd && disassembleData) {
+			//The layout of the rows depends on the content of RAM
+			entry.Volatile = true;
+		}
+
+		if(!(info.Flags & DisassemblySearchBank::LiveText)) {
+			lineData.Text[0] = 0;
+			lineData.Comment[0] = 0;
+			_disassembler->GetLineData(row, cpuType, memType, lineData);
+
+			info.TextSize = (uint16_t)strnlen(lineData.Text, sizeof(lineData.Text));
+			info.CommentSize = (uint16_t)strnlen(lineData.Comment, sizeof(lineData.Comment));
+			entry.Text.append(lineData.Text, info.TextSize);
+			entry.Text.push_back(0);
+			entry.Text.append(lineData.Comment, info.CommentSize);
+			entry.Text.push_back(0);
+
+			const char* text = entry.Text.c_str() + info.Offset;
+			for(int i = 0; i + 2 < info.TextSize; i++) {
+				entry.Trigrams.set(GetTrigram(text[i], text[i + 1], text[i + 2]));
+			}
+			const char* comment = text + info.TextSize + 1;
+			for(int i = 0; i + 2 < info.CommentSize; i++) {
+				entry.Trigrams.set(GetTrigram(comment[i], comment[i + 1], comment[i + 2]));
+			}
+		}
+
+		entry.RowInfo.push_back(info);
+	}
+
+	entry.LabelVersion = _labelManager->GetVersion();
+	entry.SourceGeneration = _disassembler->GetSourceGeneration();
+	entry.ConfigFlags = GetConfigFlags();
+	entry.CpuFlags = entry.UsesCpuFlags ? GetCpuFlags(cpuType) : -1;
+	entry.MemoryKey = entry.Volatile ? 0 : GetMemoryKey(cpuType, bank);
+
+	_cacheSize -= entry.Size;
+	entry.Size = entry.Rows.capacity() * sizeof(DisassemblyResult) + entry.RowInfo.capacity() * sizeof(DisassemblySearchBank::RowText) + entry.Text.capacity();
+	_cacheSize += entry.Size;
+}
+
+DisassemblySearchBank& DisassemblySearch::GetBank(CpuType cpuType, uint16_t bank)
+{
+	DisassemblySearchBank& entry = _banks[((uint32_t)cpuType << 16) | bank];
+
+	bool isValid = false;
+	if(entry.LastSearch != 0) {
+		if(entry.Volatile) {
+			//Volatile banks only stay valid for the duration of a single search
+			isValid = entry.LastSearch == _searchCounter;
+		} else {
+			isValid = (
+				entry.LabelVersion == _labelManager->GetVersion() &&
+				entry.SourceGeneration == _disassembler->GetSourceGeneration() &&
+				entry.ConfigFlags == GetConfigFlags() &&
+				(!entry.UsesCpuFlags || entry.CpuFlags == GetCpuFlags(cpuType)) &&
+				entry.MemoryKey == GetMemoryKey(cpuType, bank)
+			);
+		}
+	}
+
+	if(!isValid) {
+		BuildBank(entry, cpuType, bank);
+	}
+	entry.LastSearch = _searchCounter;
+	return entry;
+}
+
+void DisassemblySearch::EvictBanks()
+{
+	while(_cacheSize > MaxCacheSize) {
+		auto oldest = _banks.end();
+		for(auto it = _banks.begin(); it != _banks.end(); it++) {
+			if(it->second.LastSearch != _searchCounter && (oldest == _banks.end() || it->second.LastSearch < oldest->second.LastSearch)) {
+				oldest = it;
+			}
+		}
+
+		if(oldest == _banks.end()) {
+			//Everything in the cache was used by the current search
+			break;
+		}
+
+		_cacheSize -= oldest->second.Size;
+		_banks.erase(oldest);
+	}
+}
+
+bool DisassemblySearch::CanMatchEffectiveAddress(string& needle, DisassemblySearchOptions& options)
+{
+	//The effective address is shown as [label] or [$1234], and the value as $12 or $1234
+	//Only check them when the search string could match one of these
+	bool hexOnly = true;
+	for(char c : needle) {
+		if(!(c == '[' || c == ']' || c == '$' || (c >= '0' && c <= '9') || (tolower(c) >= 'a' && tolower(c) <= 'f'))) {
+			hexOnly = false;
+			break;
+		}
+	}
+
+	if(hexOnly) {
+		return true;
+	}
+
+	string labelPart = needle;
+	labelPart.erase(std::remove_if(labelPart.begin(), labelPart.end(), [](char c) { return c == '[' || c == ']'; }), labelPart.end());
+	return _labelManager->AnyLabelMatches([&](const string& label) {
+		if(options.MatchCase) {
+			return label.find(labelPart) != string::npos;
+		} else {
+			return std::search(label.begin(), label.end(), labelPart.begin(), labelPart.end(), [](char a, char b) { return tolower(a) == b; }) != label.end();
+		}
+	});
 }
 
 uint32_t DisassemblySearch::SearchDisassembly(CpuType cpuType, const char* searchString, int32_t startAddress, DisassemblySearchOptions options, CodeLineData searchResults[], uint32_t maxResultCount)
@@ -27,23 +264,32 @@ uint32_t DisassemblySearch::SearchDisassembly(CpuType cpuType, const char* searc
 	uint16_t bank = startAddress >> 16;
 	uint16_t maxBank = _disassembler->GetMaxBank(cpuType);
 
-	vector<DisassemblyResult> rows = _disassembler->Disassemble(cpuType, bank);
-	if(rows.empty()) {
+	_searchCounter++;
+
+	DisassemblySearchBank* entry = &GetBank(cpuType, bank);
+	if(entry->Rows.empty()) {
 		return -1;
 	}
 	int step = options.SearchBackwards ? -1 : 1;
 
 	string searchStr = searchString;
 
-	int32_t startRow = _disassembler->GetMatchingRow(rows, startAddress, options.SearchBackwards);
+	//Trigrams of the search string, if the bank doesn't contain all of them, its text can't match
+	vector<uint32_t> needleTrigrams;
+	for(size_t i = 0; i + 2 < searchStr.size(); i++) {
+		needleTrigrams.push_back(GetTrigram(searchStr[i], searchStr[i + 1], searchStr[i + 2]));
+	}
+	bool checkEffectiveAddress = CanMatchEffectiveAddress(searchStr, options);
+
+	int32_t startRow = _disassembler->GetMatchingRow(entry->Rows, startAddress, options.SearchBackwards);
 	if(options.SearchBackwards) {
 		startRow--;
 	} else if(options.SkipFirstLine) {
 		startRow++;
 	}
 
-	if(startRow >= 0 && startRow < rows.size()) {
-		startAddress = rows[startRow].CpuAddress;
+	if(startRow >= 0 && startRow < (int32_t)entry->Rows.size()) {
+		startAddress = entry->Rows[startRow].CpuAddress;
 	}
 
 	uint32_t resultCount = 0;
@@ -55,7 +301,22 @@ uint32_t DisassemblySearch::SearchDisassembly(CpuType cpuType, const char* searc
 
 	string txt;
 
+	auto addResult = [&]() {
+		searchResults[resultCount] = lineData;
+		return maxResultCount == ++resultCount;
+	};
+
 	do {
+		vector<DisassemblyResult>& rows = entry->Rows;
+
+		bool canMatchText = true;
+		for(uint32_t trigram : needleTrigrams) {
+			if(!entry->Trigrams[trigram]) {
+				canMatchText = false;
+				break;
+			}
+		}
+
 		for(int i = startRow; i >= 0 && i < rows.size(); i += step) {
 			if(rows[i].CpuAddress < 0) {
 				continue;
@@ -76,24 +337,44 @@ uint32_t DisassemblySearch::SearchDisassembly(CpuType cpuType, const char* searc
 
 			prevAddress = rows[i].CpuAddress;
 
-			_disassembler->GetLineData(rows[i], cpuType, memType, lineData);
+			DisassemblySearchBank::RowText& info = entry->RowInfo[i];
+			bool hasLineData = false;
+			auto loadLineData = [&]() {
+				if(!hasLineData) {
+					lineData.Text[0] = 0;
+					lineData.Comment[0] = 0;
+					_disassembler->GetLineData(rows[i], cpuType, memType, lineData);
+					hasLineData = true;
+				}
+			};
 
-			if(TextContains(searchStr, lineData.Text, 1000, options)) {
-				searchResults[resultCount] = lineData;
-				if(maxResultCount == ++resultCount) {
-					return resultCount;
+			if(info.Flags & DisassemblySearchBank::LiveText) {
+				loadLineData();
+				if(TextContains(searchStr, lineData.Text, 1000, options) || TextContains(searchStr, lineData.Comment, 1000, options)) {
+					if(addResult()) {
+						return resultCount;
+					}
+					continue;
+				}
+			} else if(canMatchText) {
+				const char* text = entry->Text.c_str() + info.Offset;
+				const char* comment = text + info.TextSize + 1;
+				if(TextContains(searchStr, text, info.TextSize, options) || TextContains(searchStr, comment, info.CommentSize, options)) {
+					loadLineData();
+					if(addResult()) {
+						return resultCount;
+					}
+					continue;
 				}
-				continue;
 			}
 
-			if(TextContains(searchStr, lineData.Comment, 1000, options)) {
-				searchResults[resultCount] = lineData;
-				if(maxResultCount == ++resultCount) {
-					return resultCount;
-				}
+			if(!checkEffectiveAddress || !(info.Flags & DisassemblySearchBank::Instruction)) {
 				continue;
 			}
 
+			//The effective address and value depend on the CPU's current state and can't be cached
+			loadLineData();
+
 			if(lineData.EffectiveAddress.ShowAddress && lineData.EffectiveAddress.Address.Address >= 0) {
 				txt = _labelManager->GetLabel(lineData.EffectiveAddress.Address);
 				if(txt.empty()) {
@@ -103,8 +384,7 @@ uint32_t DisassemblySearch::SearchDisassembly(CpuType cpuType, const char* searc
 				}
 
 				if(TextContains(searchStr, txt.c_str(), (int)txt.size(), options)) {
-					searchResults[resultCount] = lineData;
-					if(maxResultCount == ++resultCount) {
+					if(addResult()) {
 						return resultCount;
 					}
 					continue;
@@ -114,8 +394,7 @@ uint32_t DisassemblySearch::SearchDisassembly(CpuType cpuType, const char* searc
 			if(maxResultCount == 1 && lineData.EffectiveAddress.ValueSize > 0) {
 				txt = "$" + (lineData.EffectiveAddress.ValueSize == 2 ? HexUtilities::ToHex((uint16_t)lineData.Value) : HexUtilities::ToHex((uint8_t)lineData.Value));
 				if(TextContains(searchStr, txt.c_str(), (int)txt.size(), options)) {
-					searchResults[resultCount] = lineData;
-					if(maxResultCount == ++resultCount) {
+					if(addResult()) {
 						return resultCount;
 					}
 					continue;
@@ -134,11 +413,11 @@ uint32_t DisassemblySearch::SearchDisassembly(CpuType cpuType, const char* searc
 			nextBank = 0;
 		}
 		bank = (uint16_t)nextBank;
-		rows = _disassembler->Disassemble(cpuType, bank);
-		if(rows.empty()) {
+		entry = &GetBank(cpuType, bank);
+		if(entry->Rows.empty()) {
 			return resultCount;
 		}
-		startRow = options.SearchBackwards ? (int32_t)rows.size() - 1 : 0;
+		startRow = options.SearchBackwards ? (int32_t)entry->Rows.size() - 1 : 0;
 	} while(true);
 
 	return resultCount;
@@ -3,6 +3,7 @@
 #include "Debugger/DisassemblyInfo.h"
 #include "Debugger/DebugTypes.h"
 #include "Debugger/DebugUtilities.h"
+#include <bitset>
 
 class Disassembler;
 class LabelManager;
@@ -16,12 +17,72 @@ struct DisassemblySearchOptions
 	bool SkipFirstLine;
 };
 
+//Cached disassembly (rows + searchable text) for a single bank
+struct DisassemblySearchBank
+{
+	enum RowFlags : uint8_t
+	{
+		//Text depends on the content of RAM, it is generated again when searching
+		LiveText = 0x01,
+		//Row is an instruction, its effective address/value may need to be checked when searching
+		Instruction = 0x02,
+	};
+
+	struct RowText
+	{
+		uint32_t Offset;
+		uint16_t TextSize;
+		uint16_t CommentSize;
+		uint8_t Flags;
+	};
+
+	vector<DisassemblyResult> Rows;
+	vector<RowText> RowInfo;
+
+	//Text and comment of every row (each is null-terminated)
+	string Text;
+
+	//Set of the trigrams (lowercase) found in the text, used to skip banks that can't contain the search string
+	std::bitset<4096> Trigrams;
+
+	//Values used to detect changes that require the bank's disassembly to be generated again
+	uint64_t MemoryKey = 0;
+	uint32_t LabelVersion = 0;
+	uint32_t SourceGeneration = 0;
+	uint32_t ConfigFlags = 0;
+	int32_t CpuFlags = -1;
+
+	//Bank contains code disassembled from RAM, it is generated again on every search
+	bool Volatile = false;
+	bool UsesCpuFlags = false;
+
+	uint32_t LastSearch = 0;
+	size_t Size = 0;
+};
+
 class DisassemblySearch
 {
 private:
+	//Limit the amount of memory used by the cached banks (least recently searched banks are evicted first)
+	static constexpr size_t MaxCacheSize = 64 * 1024 * 1024;
+
 	Disassembler* _disassembler;
 	LabelManager* _labelManager;
 
+	unordered_map<uint32_t, DisassemblySearchBank> _banks;
+	uint32_t _searchCounter = 0;
+	size_t _cacheSize = 0;
+
+	DisassemblySearchBank& GetBank(CpuType cpuType, uint16_t bank);
+	void BuildBank(DisassemblySearchBank& entry, CpuType cpuType, uint16_t bank);
+	uint64_t GetMemoryKey(CpuType cpuType, uint16_t bank);
+	uint32_t GetConfigFlags();
+	int32_t GetCpuFlags(CpuType cpuType);
+	void EvictBanks();
+
+	static uint32_t GetTrigram(char a, char b, char c);
+	bool CanMatchEffectiveAddress(string& needle, DisassemblySearchOptions& options);
+
 	uint32_t SearchDisassembly(CpuType cpuType, const char* searchString, int32_t startAddress, DisassemblySearchOptions options, CodeLineData searchResults[], uint32_t maxResultCount);
 
 	template<bool matchCase> bool TextContains(string& needle, const char* hay, int size, DisassemblySearchOptions& options);
@@ -27,6 +27,8 @@ protected:
 
 	FrozenAddressManager _frozenAddressManager;
 
+	DebuggerHookFlags _hookFlags = DebuggerHookFlags::None;
+
 public:
 	bool IgnoreBreakpoints = false;
 	bool AllowChangeProgramCounter = false;
@@ -44,6 +46,12 @@ public:
 
 	FrozenAddressManager& GetFrozenAddressManager() { return _frozenAddressManager; }
 
+	void SetHookFlags(DebuggerHookFlags flags) { _hookFlags = flags; }
+	__forceinline bool CheckHookFlag(DebuggerHookFlags flag) { return ((uint32_t)_hookFlags & (uint32_t)flag) != 0; }
+
+	//True when no tool needs the full read/write hooks and no step is in progress
+	__forceinline bool IsCdlOnly() { return _hookFlags == DebuggerHookFlags::None && !_step->HasRequest && !_step->BreakNeeded; }
+
 	virtual void ResetPrevOpCode() {}
 
 	virtual void Step(int32_t stepCount, StepType type) = 0;
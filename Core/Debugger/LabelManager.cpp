@@ -14,12 +14,14 @@ void LabelManager::ClearLabels()
 	DebugBreakHelper helper(_debugger);
 	_codeLabels.clear();
 	_codeLabelReverseLookup.clear();
+	_version++;
 }
 
 void LabelManager::SetLabel(uint32_t address, MemoryType memType, string label, string comment)
 {
 	DebugBreakHelper helper(_debugger);
 	uint64_t key = GetLabelKey(address, memType);
+	_version++;
 
 	auto existingLabel = _codeLabels.find(key);
 	if(existingLabel != _codeLabels.end()) {
@@ -117,6 +119,16 @@ bool LabelManager::GetLabelAndComment(AddressInfo address, LabelInfo &labelInfo)
 	return false;
 }
 
+bool LabelManager::AnyLabelMatches(std::function<bool(const string&)> predicate)
+{
+	for(auto& entry : _codeLabels) {
+		if(!entry.second.Label.empty() && predicate(entry.second.Label)) {
+			return true;
+		}
+	}
+	return false;
+}
+
 bool LabelManager::ContainsLabel(string &label)
 {
 	return _codeLabelReverseLookup.find(label) != _codeLabelReverseLookup.end();
@@ -29,6 +29,7 @@ private:
 	unordered_map<string, uint64_t> _codeLabelReverseLookup;
 
 	Debugger *_debugger;
+	uint32_t _version = 0;
 
 	int64_t GetLabelKey(uint32_t absoluteAddr, MemoryType memType);
 	MemoryType GetKeyMemoryType(uint64_t key);
@@ -50,4 +51,8 @@ public:
 	bool ContainsLabel(string &label);
 
 	bool HasLabelOrComment(AddressInfo address);
+
+	//Incremented every time a label or comment is added, changed or removed
+	uint32_t GetVersion() { return _version; }
+	bool AnyLabelMatches(std::function<bool(const string&)> predicate);
 };
@@ -14,6 +14,7 @@
 #include "Shared/CheatManager.h"
 #include "Shared/RewindManager.h"
 #include "Shared/SaveStateManager.h"
+#include "Shared/PerformanceCounters.h"
 #include "Shared/Emulator.h"
 #include "Shared/Video/BaseVideoFilter.h"
 #include "Shared/Video/VideoRenderer.h"
@@ -136,6 +137,9 @@ int LuaApi::GetLibrary(lua_State *lua)
 		{ "getAccessCounters", LuaApi::GetAccessCounters },
 		{ "resetAccessCounters", LuaApi::ResetAccessCounters },
 
+		{ "getPerformanceCounters", LuaApi::GetPerformanceCounters },
+		{ "resetPerformanceCounters", LuaApi::ResetPerformanceCounters },
+
 		{ "addCheat", LuaApi::AddCheat },
 		{ "clearCheats", LuaApi::ClearCheats },
 
@@ -912,6 +916,43 @@ int LuaApi::ResetAccessCounters(lua_State *lua)
 	return l.ReturnCount();
 }
 
+int LuaApi::GetPerformanceCounters(lua_State *lua)
+{
+	LuaCallHelper l(lua);
+	checkparams();
+
+	PerformanceCounters* counters = _emu->GetPerformanceCounters();
+
+	lua_newtable(lua);
+	for(int i = 0; i < (int)PerfStage::StageCount; i++) {
+		PerfStageStats stats = counters->GetStats((PerfStage)i);
+
+		//Use camel case stage names as keys (e.g "audioMixing")
+		string name = PerformanceCounters::GetStageName((PerfStage)i);
+		name[0] = (char)std::tolower(name[0]);
+
+		lua_pushstring(lua, name.c_str());
+		lua_newtable(lua);
+		lua_pushintvalue(sampleCount, stats.SampleCount);
+		lua_pushdoublevalue(last, stats.Last);
+		lua_pushdoublevalue(average, stats.Average);
+		lua_pushdoublevalue(p50, stats.P50);
+		lua_pushdoublevalue(p99, stats.P99);
+		lua_pushdoublevalue(max, stats.Max);
+		lua_settable(lua, -3);
+	}
+
+	return 1;
+}
+
+int LuaApi::ResetPerformanceCounters(lua_State *lua)
+{
+	LuaCallHelper l(lua);
+	checkparams();
+	_emu->GetPerformanceCounters()->Reset();
+	return l.ReturnCount();
+}
+
 int LuaApi::GetScriptDataFolder(lua_State *lua)
 {
 	LuaCallHelper l(lua);
@@ -88,6 +88,9 @@ public:
 	static int GetAccessCounters(lua_State *lua);
 	static int ResetAccessCounters(lua_State *lua);
 
+	static int GetPerformanceCounters(lua_State *lua);
+	static int ResetPerformanceCounters(lua_State *lua);
+
 private:
 	static FrameInfo InternalGetScreenSize();
 
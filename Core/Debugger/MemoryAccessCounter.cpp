@@ -14,30 +14,48 @@ MemoryAccessCounter::MemoryAccessCounter(Debugger* debugger)
 	_enableBreakOnUninitRead = _debugger->GetConsole()->GetMasterClock() < 1000;
 
 	for(int i = (int)DebugUtilities::GetLastCpuMemoryType() + 1; i < DebugUtilities::GetMemoryTypeCount(); i++) {
-		uint32_t memSize = _debugger->GetMemoryDumper()->GetMemorySize((MemoryType)i);
-		_counters[i].reserve(memSize);
-		for(uint32_t j = 0; j < memSize; j++) {
-			_counters[i].push_back({});
+		_memorySize[i] = _debugger->GetMemoryDumper()->GetMemorySize((MemoryType)i);
+	}
+}
+
+MemoryAccessCounter::~MemoryAccessCounter()
+{
+	for(int i = 0; i < DebugUtilities::GetMemoryTypeCount(); i++) {
+		for(int j = 0; j < AccessPlaneType::PlaneCount; j++) {
+			delete _planes[i][j].exchange(nullptr);
 		}
 	}
 }
 
+MemoryAccessCounter::AccessPlane* MemoryAccessCounter::CreatePlane(MemoryType memType, AccessPlaneType planeType)
+{
+	uint32_t size = _memorySize[(int)memType];
+	AccessPlane* plane = new AccessPlane();
+	plane->Stamps.reset(new uint64_t[size]());
+	plane->Counters.reset(new uint32_t[size]());
+	_planes[(int)memType][planeType] = plane;
+	return plane;
+}
+
 ReadResult MemoryAccessCounter::ProcessMemoryRead(AddressInfo &addressInfo, uint64_t masterClock)
 {
 	if(addressInfo.Address < 0) {
 		return ReadResult::Normal;
 	}
 
-	AddressCounters& counts = _counters[(int)addressInfo.Type][addressInfo.Address];
-	if(_enableBreakOnUninitRead && counts.WriteStamp == 0 && DebugUtilities::IsVolatileRam(addressInfo.Type)) {
-		ReadResult result = counts.ReadStamp == 0 ? ReadResult::FirstUninitRead : ReadResult::UninitRead;
-		counts.ReadStamp = masterClock;
-		counts.ReadCounter++;
-		return result;
+	AccessPlane* readPlane = GetPlane(addressInfo.Type, AccessPlaneType::ReadPlane);
+	if(_enableBreakOnUninitRead && DebugUtilities::IsVolatileRam(addressInfo.Type)) {
+		AccessPlane* writePlane = _planes[(int)addressInfo.Type][AccessPlaneType::WritePlane];
+		if(!writePlane || writePlane->Stamps[addressInfo.Address] == 0) {
+			ReadResult result = readPlane->Stamps[addressInfo.Address] == 0 ? ReadResult::FirstUninitRead : ReadResult::UninitRead;
+			readPlane->Stamps[addressInfo.Address] = masterClock;
+			readPlane->Counters[addressInfo.Address]++;
+			return result;
+		}
 	}
 
-	counts.ReadStamp = masterClock;
-	counts.ReadCounter++;
+	readPlane->Stamps[addressInfo.Address] = masterClock;
+	readPlane->Counters[addressInfo.Address]++;
 	return ReadResult::Normal;
 }
 
@@ -47,9 +65,7 @@ void MemoryAccessCounter::ProcessMemoryWrite(AddressInfo& addressInfo, uint64_t
 		return;
 	}
 
-	AddressCounters& counts = _counters[(int)addressInfo.Type][addressInfo.Address];
-	counts.WriteStamp = masterClock;
-	counts.WriteCounter++;
+	UpdatePlane(addressInfo, AccessPlaneType::WritePlane, masterClock);
 }
 
 void MemoryAccessCounter::ProcessMemoryExec(AddressInfo& addressInfo, uint64_t masterClock)
@@ -58,20 +74,57 @@ void MemoryAccessCounter::ProcessMemoryExec(AddressInfo& addressInfo, uint64_t m
 		return;
 	}
 
-	AddressCounters& counts = _counters[(int)addressInfo.Type][addressInfo.Address];
-	counts.ExecStamp = masterClock;
-	counts.ExecCounter++;
+	UpdatePlane(addressInfo, AccessPlaneType::ExecPlane, masterClock);
 }
 
 void MemoryAccessCounter::ResetCounts()
 {
 	DebugBreakHelper helper(_debugger);
+
+	//Clear the existing planes rather than releasing them, the UI may be reading them at the same time
 	for(int i = 0; i < DebugUtilities::GetMemoryTypeCount(); i++) {
-		memset(_counters[i].data(), 0, _counters[i].size() * sizeof(AddressCounters));
+		for(int j = 0; j < AccessPlaneType::PlaneCount; j++) {
+			AccessPlane* plane = _planes[i][j];
+			if(plane) {
+				memset(plane->Stamps.get(), 0, _memorySize[i] * sizeof(uint64_t));
+				memset(plane->Counters.get(), 0, _memorySize[i] * sizeof(uint32_t));
+			}
+		}
 	}
 	_enableBreakOnUninitRead = _debugger->GetConsole()->GetMasterClock() < 1000;
 }
 
+void MemoryAccessCounter::CopyPlane(AccessPlaneType planeType, MemoryType memType, uint32_t offset, uint32_t length, AddressCounters counts[])
+{
+	AccessPlane* plane = _planes[(int)memType][planeType];
+	uint64_t* stamps = plane ? plane->Stamps.get() + offset : nullptr;
+	uint32_t* counters = plane ? plane->Counters.get() + offset : nullptr;
+
+	switch(planeType) {
+		default:
+		case AccessPlaneType::ReadPlane:
+			for(uint32_t i = 0; i < length; i++) {
+				counts[i].ReadStamp = stamps ? stamps[i] : 0;
+				counts[i].ReadCounter = counters ? counters[i] : 0;
+			}
+			break;
+
+		case AccessPlaneType::WritePlane:
+			for(uint32_t i = 0; i < length; i++) {
+				counts[i].WriteStamp = stamps ? stamps[i] : 0;
+				counts[i].WriteCounter = counters ? counters[i] : 0;
+			}
+			break;
+
+		case AccessPlaneType::ExecPlane:
+			for(uint32_t i = 0; i < length; i++) {
+				counts[i].ExecStamp = stamps ? stamps[i] : 0;
+				counts[i].ExecCounter = counters ? counters[i] : 0;
+			}
+			break;
+	}
+}
+
 void MemoryAccessCounter::GetAccessCounts(uint32_t offset, uint32_t length, MemoryType memoryType, AddressCounters counts[])
 {
 	if(DebugUtilities::IsRelativeMemory(memoryType)) {
@@ -81,12 +134,16 @@ void MemoryAccessCounter::GetAccessCounts(uint32_t offset, uint32_t length, Memo
 			addr.Address = offset + i;
 			AddressInfo info = _debugger->GetAbsoluteAddress(addr);
 			if(info.Address >= 0) {
-				counts[i] = _counters[(int)info.Type][info.Address];
+				for(int j = 0; j < AccessPlaneType::PlaneCount; j++) {
+					CopyPlane((AccessPlaneType)j, info.Type, info.Address, 1, counts + i);
+				}
 			}
 		}
 	} else {
-		if(offset + length <= _counters[(int)memoryType].size()) {
-			memcpy(counts, _counters[(int)memoryType].data() + offset, length * sizeof(AddressCounters));
+		if(offset + length <= _memorySize[(int)memoryType]) {
+			for(int j = 0; j < AccessPlaneType::PlaneCount; j++) {
+				CopyPlane((AccessPlaneType)j, memoryType, offset, length, counts);
+			}
 		}
 	}
 }
@@ -33,13 +33,49 @@ enum class ReadResult
 class MemoryAccessCounter
 {
 private:
-	vector<AddressCounters> _counters[DebugUtilities::GetMemoryTypeCount()];
+	enum AccessPlaneType
+	{
+		ReadPlane = 0,
+		WritePlane = 1,
+		ExecPlane = 2,
+		PlaneCount = 3
+	};
+
+	//Stamps & counters for a single access type, stored as separate contiguous arrays
+	struct AccessPlane
+	{
+		unique_ptr<uint64_t[]> Stamps;
+		unique_ptr<uint32_t[]> Counters;
+	};
+
+	//Planes are only allocated the first time a memory type is accessed in a given way
+	//(e.g ROM never gets a write plane), null means all counts are 0
+	atomic<AccessPlane*> _planes[DebugUtilities::GetMemoryTypeCount()][AccessPlaneType::PlaneCount] = {};
+	uint32_t _memorySize[DebugUtilities::GetMemoryTypeCount()] = {};
 
 	Debugger* _debugger = nullptr;
 	bool _enableBreakOnUninitRead = false;
 
+	__noinline AccessPlane* CreatePlane(MemoryType memType, AccessPlaneType planeType);
+
+	__forceinline AccessPlane* GetPlane(MemoryType memType, AccessPlaneType planeType)
+	{
+		AccessPlane* plane = _planes[(int)memType][planeType];
+		return plane ? plane : CreatePlane(memType, planeType);
+	}
+
+	__forceinline void UpdatePlane(AddressInfo& addressInfo, AccessPlaneType planeType, uint64_t masterClock)
+	{
+		AccessPlane* plane = GetPlane(addressInfo.Type, planeType);
+		plane->Stamps[addressInfo.Address] = masterClock;
+		plane->Counters[addressInfo.Address]++;
+	}
+
+	void CopyPlane(AccessPlaneType planeType, MemoryType memType, uint32_t offset, uint32_t length, AddressCounters counts[]);
+
 public:
 	MemoryAccessCounter(Debugger *debugger);
+	~MemoryAccessCounter();
 
 	ReadResult ProcessMemoryRead(AddressInfo& addressInfo, uint64_t masterClock);
 	void ProcessMemoryWrite(AddressInfo& addressInfo, uint64_t masterClock);
@@ -5,7 +5,9 @@
 #include "Debugger/Debugger.h"
 #include "Debugger/MemoryDumper.h"
 #include "Debugger/DebugTypes.h"
+#include "Debugger/LabelManager.h"
 #include "Shared/Interfaces/IConsole.h"
+#include "Utilities/HexUtilities.h"
 
 static constexpr int32_t ResetFunctionIndex = -1;
 
@@ -20,77 +22,120 @@ Profiler::~Profiler()
 {
 }
 
-void Profiler::StackFunction(AddressInfo &addr, StackFrameFlags stackFlag)
+uint32_t Profiler::GetFunctionIndex(AddressInfo& addr)
 {
-	if(addr.Address >= 0) {
-		uint32_t key = addr.Address | ((uint8_t)addr.Type << 24);
-		if(_functions.find(key) == _functions.end()) {
-			_functions[key] = ProfiledFunction();
-			_functions[key].Address = addr;
-		}
+	vector<vector<int32_t>>& pages = _functionIndexes[(int)addr.Type];
+	uint32_t pageIndex = (uint32_t)addr.Address / Profiler::FunctionPageSize;
+	if(pageIndex >= pages.size()) {
+		pages.resize(pageIndex + 1);
+	}
 
-		UpdateCycles();
+	vector<int32_t>& page = pages[pageIndex];
+	if(page.empty()) {
+		page.resize(Profiler::FunctionPageSize, -1);
+	}
 
-		_stackFlags.push_back(stackFlag);
-		_cycleCountStack.push_back(_currentCycleCount);
-		_functionStack.push_back(_currentFunction);
+	int32_t& index = page[(uint32_t)addr.Address % Profiler::FunctionPageSize];
+	if(index < 0) {
+		index = (int32_t)_functions.size();
+		_functions.push_back(ProfiledFunction());
+		_functions.back().Address = addr;
+		_activeCount.push_back(0);
+	}
+	return (uint32_t)index;
+}
 
-		if(_functionStack.size() > 100) {
-			//Keep stack to 100 functions at most (to prevent performance issues, esp. in debug builds)
-			//Only happens when software doesn't use JSR/RTS normally to enter/leave functions
-			_functionStack.pop_front();
-			_cycleCountStack.pop_front();
-			_stackFlags.pop_front();
+uint32_t Profiler::GetNodeIndex(uint32_t parentNode, uint32_t function)
+{
+	int32_t prev = -1;
+	int32_t index = _nodes[parentNode].FirstChild;
+	while(index >= 0) {
+		ProfilerCallNode& node = _nodes[index];
+		if(node.Function == function) {
+			if(prev >= 0) {
+				//Move the child to the front of the list, functions called in a loop are found on the first try
+				_nodes[prev].NextSibling = node.NextSibling;
+				node.NextSibling = _nodes[parentNode].FirstChild;
+				_nodes[parentNode].FirstChild = index;
+			}
+			return (uint32_t)index;
 		}
-
-		ProfiledFunction& func = _functions[key];
-		func.CallCount++;
-
-		_currentFunction = key;
-		_currentCycleCount = 0;
+		prev = index;
+		index = node.NextSibling;
 	}
+
+	index = (int32_t)_nodes.size();
+	ProfilerCallNode node;
+	node.Parent = (int32_t)parentNode;
+	node.Function = function;
+	node.NextSibling = _nodes[parentNode].FirstChild;
+	_nodes[parentNode].FirstChild = index;
+	_nodes.push_back(node);
+	return (uint32_t)index;
 }
 
-void Profiler::UpdateCycles()
+void Profiler::UpdateExclusiveCycles(uint64_t masterClock)
 {
-	uint64_t masterClock = _console->GetMasterClock();
-	
-	ProfiledFunction& func = _functions[_currentFunction];
+	//Only the function at the top of the stack is running, inclusive times are calculated when functions return
 	uint64_t clockGap = masterClock - _prevMasterClock;
-	func.ExclusiveCycles += clockGap;
-	func.InclusiveCycles += clockGap;
-	
-	int32_t len = (int32_t)_functionStack.size();
-	for(int32_t i = len - 1; i >= 0; i--) {
-		_functions[_functionStack[i]].InclusiveCycles += clockGap;
-		if(_stackFlags[i] != StackFrameFlags::None) {
-			//Don't apply inclusive times to stack frames before an IRQ/NMI
-			break;
-		}
+	ProfilerStackFrame& frame = _stack.back();
+	_functions[frame.Function].ExclusiveCycles += clockGap;
+	_nodes[frame.Node].ExclusiveCycles += clockGap;
+	_prevMasterClock = masterClock;
+}
+
+void Profiler::StackFunction(AddressInfo &addr, StackFrameFlags stackFlag)
+{
+	if(addr.Address < 0) {
+		return;
 	}
 
-	_currentCycleCount += clockGap;
-	_prevMasterClock = masterClock;
+	uint64_t masterClock = _console->GetMasterClock();
+	UpdateExclusiveCycles(masterClock);
+
+	ProfilerStackFrame frame;
+	frame.Function = GetFunctionIndex(addr);
+	frame.Node = GetNodeIndex(_stack.back().Node, frame.Function);
+	frame.Flags = stackFlag;
+	frame.StartClock = masterClock;
+
+	_functions[frame.Function].CallCount++;
+	_nodes[frame.Node].CallCount++;
+	_activeCount[frame.Function]++;
+	_stack.push_back(frame);
+
+	if(_stack.size() > Profiler::MaxStackDepth) {
+		//Drop the oldest call (the reset frame at the bottom is kept), it will never return
+		_activeCount[_stack[1].Function]--;
+		_stack.erase(_stack.begin() + 1);
+	}
 }
 
 void Profiler::UnstackFunction()
 {
-	if(!_functionStack.empty()) {
-		UpdateCycles();
+	if(_stack.size() <= 1) {
+		return;
+	}
 
-		//Return to the previous function
-		ProfiledFunction& func = _functions[_currentFunction];
-		func.MinCycles = std::min(func.MinCycles, _currentCycleCount);
-		func.MaxCycles = std::max(func.MaxCycles, _currentCycleCount);
+	uint64_t masterClock = _console->GetMasterClock();
+	UpdateExclusiveCycles(masterClock);
+
+	ProfilerStackFrame frame = _stack.back();
+	_stack.pop_back();
 
-		_currentFunction = _functionStack.back();
-		_functionStack.pop_back();
-		_stackFlags.pop_back();
+	uint64_t duration = masterClock - frame.StartClock;
+	uint64_t callCycles = duration - frame.InterruptCycles;
 
-		//Add the subroutine's cycle count to the current routine's cycle count
-		_currentCycleCount = _cycleCountStack.back() + _currentCycleCount;
-		_cycleCountStack.pop_back();
+	ProfiledFunction& func = _functions[frame.Function];
+	func.MinCycles = std::min(func.MinCycles, callCycles);
+	func.MaxCycles = std::max(func.MaxCycles, callCycles);
+	if(--_activeCount[frame.Function] == 0) {
+		//Only count the outermost call for recursive functions
+		func.InclusiveCycles += callCycles;
 	}
+
+	//Don't apply inclusive times of IRQ/NMI handlers to the functions they interrupted
+	_stack.back().InterruptCycles += frame.Flags != StackFrameFlags::None ? duration : frame.InterruptCycles;
 }
 
 void Profiler::Reset()
@@ -102,35 +147,106 @@ void Profiler::Reset()
 void Profiler::ResetState()
 {
 	_prevMasterClock = _console->GetMasterClock();
-	_currentCycleCount = 0;
-	_functionStack.clear();
-	_stackFlags.clear();
-	_cycleCountStack.clear();
-	_currentFunction = ResetFunctionIndex;
+	for(ProfilerStackFrame& frame : _stack) {
+		_activeCount[frame.Function]--;
+	}
+	_stack.clear();
+
+	ProfilerStackFrame resetFrame;
+	resetFrame.StartClock = _prevMasterClock;
+	_activeCount[0]++;
+	_stack.push_back(resetFrame);
 }
 
 void Profiler::InternalReset()
 {
-	ResetState();
-	
+	_stack.clear();
 	_functions.clear();
-	_functions[ResetFunctionIndex] = ProfiledFunction();
-	_functions[ResetFunctionIndex].Address = { ResetFunctionIndex, MemoryType::None };
+	_activeCount.clear();
+	_nodes.clear();
+	for(vector<vector<int32_t>>& pages : _functionIndexes) {
+		pages.clear();
+	}
+
+	_functions.push_back(ProfiledFunction());
+	_functions[0].Address = { ResetFunctionIndex, MemoryType::None };
+	_activeCount.push_back(0);
+	_nodes.push_back(ProfilerCallNode()); //Root node (reset function)
+
+	ResetState();
 }
 
 void Profiler::GetProfilerData(ProfiledFunction* profilerData, uint32_t& functionCount)
 {
 	DebugBreakHelper helper(_debugger);
 	
-	UpdateCycles();
+	uint64_t masterClock = _console->GetMasterClock();
+	UpdateExclusiveCycles(masterClock);
+
+	functionCount = (uint32_t)std::min<size_t>(_functions.size(), 100000);
+	memcpy(profilerData, _functions.data(), functionCount * sizeof(ProfiledFunction));
+
+	//Add the inclusive time of the calls that are still in progress
+	vector<bool> counted(functionCount, false);
+	vector<uint64_t> pendingCycles(_stack.size());
+	uint64_t interruptCycles = 0;
+	for(int i = (int)_stack.size() - 1; i >= 0; i--) {
+		ProfilerStackFrame& frame = _stack[i];
+		uint64_t excludedCycles = frame.InterruptCycles + interruptCycles;
+		pendingCycles[i] = masterClock - frame.StartClock - excludedCycles;
+		interruptCycles = frame.Flags != StackFrameFlags::None ? (masterClock - frame.StartClock) : excludedCycles;
+	}
+	for(size_t i = 0; i < _stack.size(); i++) {
+		uint32_t function = _stack[i].Function;
+		if(function < functionCount && !counted[function]) {
+			counted[function] = true;
+			profilerData[function].InclusiveCycles += pendingCycles[i];
+		}
+	}
+}
 
-	functionCount = 0;
-	for(auto& func : _functions) {
-		profilerData[functionCount] = func.second;
-		functionCount++;
+string Profiler::GetFunctionName(uint32_t function)
+{
+	AddressInfo addr = _functions[function].Address;
+	if(addr.Address == ResetFunctionIndex) {
+		return "[Reset]";
+	}
 
-		if(functionCount >= 100000) {
-			break;
+	string label = _debugger->GetLabelManager()->GetLabel(addr);
+	if(!label.empty()) {
+		return label;
+	}
+	return "$" + HexUtilities::ToHex24(addr.Address) + "@" + std::to_string((int)addr.Type);
+}
+
+bool Profiler::ExportFoldedStacks(string filename)
+{
+	//Writes the exclusive time of every call path since the last reset, in the "folded stacks"
+	//format used by flame graph tools (e.g: "[Reset];main;update 1234")
+	DebugBreakHelper helper(_debugger);
+	UpdateExclusiveCycles(_console->GetMasterClock());
+
+	ofstream output(filename, ios::out | ios::binary);
+	if(!output) {
+		return false;
+	}
+
+	vector<string> functionNames;
+	functionNames.reserve(_functions.size());
+	for(uint32_t i = 0; i < _functions.size(); i++) {
+		functionNames.push_back(GetFunctionName(i));
+	}
+
+	//Parent nodes are always created before their children
+	vector<string> paths(_nodes.size());
+	for(size_t i = 0; i < _nodes.size(); i++) {
+		ProfilerCallNode& node = _nodes[i];
+		paths[i] = node.Parent >= 0 ? (paths[node.Parent] + ";" + functionNames[node.Function]) : functionNames[node.Function];
+		if(node.ExclusiveCycles > 0) {
+			output << paths[i] << " " << node.ExclusiveCycles << "\n";
 		}
 	}
+
+	output.close();
+	return true;
 }
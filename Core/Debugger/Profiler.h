@@ -1,6 +1,7 @@
 #pragma once
 #include "pch.h"
 #include "Debugger/DebugTypes.h"
+#include "Debugger/DebugUtilities.h"
 
 class Debugger;
 class IConsole;
@@ -15,24 +16,58 @@ struct ProfiledFunction
 	AddressInfo Address = {};
 };
 
+//Node of the call tree, one per unique call path (used to export folded stacks)
+struct ProfilerCallNode
+{
+	int32_t Parent = -1;
+	uint32_t Function = 0;
+	uint64_t ExclusiveCycles = 0;
+	uint64_t CallCount = 0;
+
+	//Children are stored as a linked list (most recently called child first)
+	int32_t FirstChild = -1;
+	int32_t NextSibling = -1;
+};
+
+struct ProfilerStackFrame
+{
+	uint32_t Function = 0;
+	uint32_t Node = 0;
+	StackFrameFlags Flags = StackFrameFlags::None;
+	uint64_t StartClock = 0;
+
+	//Cycles spent in IRQ/NMI handlers called while this frame was active
+	uint64_t InterruptCycles = 0;
+};
+
 class Profiler
 {
 private:
+	//Keep stack to this many functions at most - only happens when software
+	//doesn't use JSR/RTS normally to enter/leave functions
+	static constexpr uint32_t MaxStackDepth = 1000;
+
+	//Function indexes are stored in pages that are only allocated when a function is called in them
+	static constexpr uint32_t FunctionPageSize = 0x1000;
+
 	Debugger* _debugger = nullptr;
 	IConsole* _console = nullptr;
 
-	unordered_map<int32_t, ProfiledFunction> _functions;
-	
-	deque<int32_t> _functionStack;
-	deque<StackFrameFlags> _stackFlags;
-	deque<uint64_t> _cycleCountStack;
+	//Functions are interned into dense indexes (index 0 is the reset vector)
+	vector<ProfiledFunction> _functions;
+	vector<uint32_t> _activeCount;
+	vector<vector<int32_t>> _functionIndexes[DebugUtilities::GetMemoryTypeCount()];
+
+	vector<ProfilerCallNode> _nodes;
 
-	uint64_t _currentCycleCount = 0;
+	deque<ProfilerStackFrame> _stack;
 	uint64_t _prevMasterClock = 0;
-	int32_t _currentFunction = -1;
 
 	void InternalReset();
-	void UpdateCycles();
+	uint32_t GetFunctionIndex(AddressInfo& addr);
+	uint32_t GetNodeIndex(uint32_t parentNode, uint32_t function);
+	void UpdateExclusiveCycles(uint64_t masterClock);
+	string GetFunctionName(uint32_t function);
 
 public:
 	Profiler(Debugger* debugger, IConsole* _console);
@@ -44,4 +79,5 @@ public:
 	void Reset();
 	void ResetState();
 	void GetProfilerData(ProfiledFunction* profilerData, uint32_t& functionCount);
+	bool ExportFoldedStacks(string filename);
 };
\ No newline at end of file
@@ -31,6 +31,7 @@ int ScriptManager::LoadScript(string name, string path, string content, int32_t
 		scriptId = script->GetScriptId();
 		_scripts.push_back(std::move(script));
 		_hasScript = true;
+		_debugger->UpdateHookFlags();
 		return scriptId;
 	} else {
 		auto result = std::find_if(_scripts.begin(), _scripts.end(), [=](unique_ptr<ScriptHost> &script) {
@@ -67,6 +68,7 @@ void ScriptManager::RemoveScript(int32_t scriptId)
 	RefreshMemoryCallbackFlags();
 
 	_hasScript = _scripts.size() > 0;
+	_debugger->UpdateHookFlags();
 }
 
 void ScriptManager::RefreshMemoryCallbackFlags()
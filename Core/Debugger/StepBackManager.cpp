@@ -5,6 +5,115 @@
 #include "Shared/SaveStateManager.h"
 #include "Shared/NotificationManager.h"
 #include "Shared/RewindManager.h"
+#include "Utilities/Timer.h"
+
+void StepBackJournal::CreateDelta(const string& newState, JournalEntry& entry)
+{
+	//Store the bytes of the current state that differ from the new state
+	entry.Delta.clear();
+	if(newState.size() != _state.size()) {
+		entry.IsFullState = true;
+		entry.Delta.insert(entry.Delta.end(), _state.begin(), _state.end());
+		return;
+	}
+
+	entry.IsFullState = false;
+
+	//Differences separated by less than this many identical bytes are merged into a single block
+	constexpr size_t maxGap = 8;
+
+	const uint8_t* prevData = (const uint8_t*)_state.data();
+	const uint8_t* newData = (const uint8_t*)newState.data();
+	size_t size = _state.size();
+	size_t i = 0;
+	while(i < size) {
+		if(i + 64 <= size && memcmp(prevData + i, newData + i, 64) == 0) {
+			i += 64;
+			continue;
+		} else if(prevData[i] == newData[i]) {
+			i++;
+			continue;
+		}
+
+		size_t start = i;
+		size_t end = i + 1;
+		for(size_t j = end; j < size && j - end < maxGap; j++) {
+			if(prevData[j] != newData[j]) {
+				end = j + 1;
+			}
+		}
+
+		uint32_t blockStart = (uint32_t)start;
+		uint32_t blockLength = (uint32_t)(end - start);
+		entry.Delta.insert(entry.Delta.end(), (uint8_t*)&blockStart, (uint8_t*)&blockStart + sizeof(blockStart));
+		entry.Delta.insert(entry.Delta.end(), (uint8_t*)&blockLength, (uint8_t*)&blockLength + sizeof(blockLength));
+		entry.Delta.insert(entry.Delta.end(), prevData + start, prevData + end);
+		i = end;
+	}
+}
+
+void StepBackJournal::ApplyDelta(JournalEntry& entry)
+{
+	if(entry.IsFullState) {
+		_state.assign((char*)entry.Delta.data(), entry.Delta.size());
+		return;
+	}
+
+	size_t pos = 0;
+	while(pos + 8 <= entry.Delta.size()) {
+		uint32_t blockStart;
+		uint32_t blockLength;
+		memcpy(&blockStart, entry.Delta.data() + pos, sizeof(blockStart));
+		memcpy(&blockLength, entry.Delta.data() + pos + 4, sizeof(blockLength));
+		memcpy(_state.data() + blockStart, entry.Delta.data() + pos + 8, blockLength);
+		pos += 8 + blockLength;
+	}
+}
+
+void StepBackJournal::AddState(uint64_t clock, string&& state)
+{
+	if(!_entries.empty()) {
+		JournalEntry& prevEntry = _entries.back();
+		CreateDelta(state, prevEntry);
+		_deltaSize += prevEntry.Delta.size();
+	}
+
+	_entries.push_back({ clock, {}, false });
+	_state = std::move(state);
+
+	while(_deltaSize > StepBackJournal::MaxJournalSize && _entries.size() > 1) {
+		//Discard the oldest states to stay within the memory limit
+		_deltaSize -= _entries.front().Delta.size();
+		_entries.pop_front();
+	}
+}
+
+void StepBackJournal::RemoveLastState()
+{
+	_entries.pop_back();
+	if(!_entries.empty()) {
+		//Undo the changes between the previous instruction and the one that was removed
+		JournalEntry& entry = _entries.back();
+		ApplyDelta(entry);
+		_deltaSize -= entry.Delta.size();
+		vector<uint8_t>().swap(entry.Delta);
+	} else {
+		_state.clear();
+	}
+}
+
+void StepBackJournal::LoadLastState(Emulator* emu)
+{
+	stringstream stateStream(_state);
+	emu->Deserialize(stateStream, SaveStateManager::FileFormatVersion, true, std::nullopt, false);
+}
+
+void StepBackJournal::Clear()
+{
+	_entries.clear();
+	_state.clear();
+	_deltaSize = 0;
+}
 
 StepBackManager::StepBackManager(Emulator* emu, IDebugger* debugger)
 {
@@ -29,10 +138,30 @@ void StepBackManager::StepBack(StepBackType type)
 		
 		_active = true;
 		_allowRetry = true;
-		_stateClockLimit = StepBackManager::DefaultClockLimit;
+		_stateClockLimit = _journalClockLimit;
 	}
 }
 
+uint64_t StepBackManager::GetNextJournalClockLimit()
+{
+	uint64_t limit = std::min<uint64_t>(_journalClockLimit * 4, _debugger->GetStepBackConfig().CyclesPerFrame);
+
+	uint64_t recordedClocks = _recordEndClock - _recordStartClock;
+	if(_recordTime > 0 && recordedClocks > 0) {
+		//Keep the time spent saving states for the next window within the budget, based on the cost measured for this window
+		double timePerClock = _recordTime / recordedClocks;
+		limit = std::min<uint64_t>(limit, (uint64_t)(StepBackManager::MaxRecordTime / timePerClock));
+	}
+
+	return std::max<uint64_t>(limit, StepBackManager::DefaultClockLimit);
+}
+
+void StepBackManager::ResetCache()
+{
+	_journal.Clear();
+	_journalClockLimit = StepBackManager::DefaultClockLimit;
+}
+
 bool StepBackManager::CheckStepBack()
 {
 	if(!_active) {
@@ -42,46 +171,62 @@ bool StepBackManager::CheckStepBack()
 	uint64_t clock = _debugger->GetStepBackConfig().CurrentCycle;
 
 	if(!_rewindManager->IsStepBack()) {
-		if(_cache.size() > 1) {
-			//Check to see if previous instruction is already in cache
-			if(_cache.back().Clock == _targetClock) {
-				//End of cache is the current instruction, remove it first
-				_cache.pop_back();
-				if(_cache.size()) {
-					//If cache isn't empty, load the last state
-					_emu->Deserialize(_cache.back().SaveState, SaveStateManager::FileFormatVersion, true, std::nullopt, false);
+		if(_journal.GetCount() > 0) {
+			//Check to see if previous instruction is already in the journal
+			if(_journal.GetLastClock() == _targetClock) {
+				//End of journal is the current instruction, remove it first
+				_journal.RemoveLastState();
+				if(_journal.GetCount()) {
+					//If the journal isn't empty, load the previous instruction's state
+					_journal.LoadLastState(_emu);
 
 					_emu->GetRewindManager()->StopRewinding(true, true);
 					_active = false;
 					_prevClock = clock;
 					return true;
 				}
+
+				//The journal ran out while stepping back repeatedly, record a larger window on the next rewind
+				//to reduce the number of times the emulation needs to be rewound and replayed
+				_journalClockLimit = GetNextJournalClockLimit();
+				_stateClockLimit = _journalClockLimit;
 			} else {
-				//On mismatch, clear cache and rewind normally instead
-				_cache.clear();
+				//On mismatch, rewind normally instead
+				_journalClockLimit = StepBackManager::DefaultClockLimit;
+				_stateClockLimit = _journalClockLimit;
 			}
 		}
 
 		//Start rewinding on next instruction after StepBack() is called
-		_cache.clear();
+		_journal.Clear();
+		_recordTime = 0;
+		_recordStartClock = 0;
+		_recordEndClock = 0;
 		_rewindManager->StartRewinding(true);
 		clock = _debugger->GetStepBackConfig().CurrentCycle;
 	}
 
 	if(clock < _targetClock && _targetClock - clock < _stateClockLimit) {
-		//Create a save state every instruction for the last X clocks
-		_cache.push_back(StepBackCacheEntry());
-		_cache.back().Clock = clock;
-		_emu->Serialize(_cache.back().SaveState, true, 0);
+		//Record the state of every instruction for the last X clocks
+		Timer timer;
+		stringstream state;
+		_emu->Serialize(state, true, 0);
+		_journal.AddState(clock, state.str());
+		_recordTime += timer.GetElapsedMS();
+
+		if(_journal.GetCount() == 1) {
+			_recordStartClock = clock;
+		}
+		_recordEndClock = clock;
 	}
 
 	if(clock >= _targetClock) {
-		//If the CPU is back to where it was before step back, check if the cache contains data
-		if(_cache.size() > 0) {
-			_emu->Deserialize(_cache.back().SaveState, SaveStateManager::FileFormatVersion, true, std::nullopt, false);
+		//If the CPU is back to where it was before step back, check if the journal contains data
+		if(_journal.GetCount() > 0) {
+			_journal.LoadLastState(_emu);
 			_rewindManager->StopRewinding(true, true);
 		} else if(_allowRetry && clock > _prevClock && (clock - _prevClock) > StepBackManager::DefaultClockLimit) {
-			//Cache is empty, this can happen when a single instruction takes more than X clocks (e.g block transfers, dma)
+			//Journal is empty, this can happen when a single instruction takes more than X clocks (e.g block transfers, dma)
 			//In this case, re-run the step back process again but start recordings state earlier
 			_rewindManager->StopRewinding(true);
 			_rewindManager->StartRewinding(true);
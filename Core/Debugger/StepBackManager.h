@@ -5,10 +5,38 @@
 class Emulator;
 class IDebugger;
 
-struct StepBackCacheEntry
+//Keeps the save states for the last instructions that were executed before the step back target.
+//Only the most recent state is stored in full - every other entry only contains the bytes that differ
+//from the entry that follows it, so going back one instruction only needs to undo a small delta.
+class StepBackJournal
 {
-	stringstream SaveState;
-	uint64_t Clock;
+private:
+	static constexpr size_t MaxJournalSize = 64 * 1024 * 1024;
+
+	struct JournalEntry
+	{
+		uint64_t Clock;
+
+		//Data needed to turn the next entry's state into this entry's state (empty for the last entry)
+		vector<uint8_t> Delta;
+		bool IsFullState;
+	};
+
+	deque<JournalEntry> _entries;
+	string _state;
+	size_t _deltaSize = 0;
+
+	void CreateDelta(const string& newState, JournalEntry& entry);
+	void ApplyDelta(JournalEntry& entry);
+
+public:
+	void AddState(uint64_t clock, string&& state);
+	void RemoveLastState();
+	void LoadLastState(Emulator* emu);
+	void Clear();
+
+	size_t GetCount() { return _entries.size(); }
+	uint64_t GetLastClock() { return _entries.back().Clock; }
 };
 
 struct StepBackConfig
@@ -29,17 +57,26 @@ class StepBackManager
 {
 private:
 	static constexpr uint64_t DefaultClockLimit = 600; //Default to 600 clocks to avoid retry when NES sprite DMA occurs (~512 cycles)
+	static constexpr double MaxRecordTime = 100; //Max time (in ms) spent saving states during a single step back
 
 	Emulator* _emu = nullptr;
 	RewindManager* _rewindManager = nullptr;
 	IDebugger* _debugger = nullptr;
 
-	vector<StepBackCacheEntry> _cache;
+	StepBackJournal _journal;
 	uint64_t _targetClock = 0;
 	uint64_t _prevClock = 0;
 	bool _active = false;
 	bool _allowRetry = false;
 	uint64_t _stateClockLimit = StepBackManager::DefaultClockLimit;
+	uint64_t _journalClockLimit = StepBackManager::DefaultClockLimit;
+
+	//Time spent saving states during the current step back, used to limit the size of the next window
+	double _recordTime = 0;
+	uint64_t _recordStartClock = 0;
+	uint64_t _recordEndClock = 0;
+
+	uint64_t GetNextJournalClockLimit();
 
 public:
 	StepBackManager(Emulator* emu, IDebugger* debugger);
@@ -47,6 +84,6 @@ public:
 	void StepBack(StepBackType type);
 	bool CheckStepBack();
 
-	void ResetCache() { _cache.clear(); }
+	void ResetCache();
 	bool IsRewinding() { return _active || _rewindManager->IsRewinding(); }
 };
\ No newline at end of file
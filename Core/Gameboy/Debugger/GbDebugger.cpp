@@ -145,7 +145,9 @@ void GbDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType t
 			DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, 0, CpuType::Gameboy);
 			_traceLogger->Log(_cpu->GetState(), disInfo, operation, addressInfo);
 		}
-		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _gameboy->GetMasterClock());
+		if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+			_memoryAccessCounter->ProcessMemoryExec(addressInfo, _gameboy->GetMasterClock());
+		}
 	} else if(type == MemoryOperationType::ExecOperand) {
 		if(addressInfo.Address >= 0 && addressInfo.Type == MemoryType::GbPrgRom) {
 			_codeDataLogger->SetCode(addressInfo.Address);
@@ -155,7 +157,9 @@ void GbDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType t
 			_traceLogger->LogNonExec(operation, addressInfo);
 		}
 
-		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _gameboy->GetMasterClock());
+		if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+			_memoryAccessCounter->ProcessMemoryExec(addressInfo, _gameboy->GetMasterClock());
+		}
 		_debugger->ProcessBreakConditions(CpuType::Gameboy, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 	} else {
 		if(addressInfo.Address >= 0 && addressInfo.Type == MemoryType::GbPrgRom) {
@@ -167,20 +171,22 @@ void GbDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType t
 		}
 
 		if(addr < 0xFE00 || addr >= 0xFF80) {
-			ReadResult result = _memoryAccessCounter->ProcessMemoryRead(addressInfo, _gameboy->GetMasterClock());
-			if(result != ReadResult::Normal) {
-				//Memory access was a read on an uninitialized memory address
-				if(result == ReadResult::FirstUninitRead) {
-					//Only warn the first time
-					_debugger->Log("[GB] Uninitialized memory read: $" + HexUtilities::ToHex((uint16_t)addr));
-				}
-				if(_settings->CheckDebuggerFlag(DebuggerFlags::GbDebuggerEnabled) && _settings->GetDebugConfig().BreakOnUninitRead) {
-					_step->Break(BreakSource::BreakOnUninitMemoryRead);
+			if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+				ReadResult result = _memoryAccessCounter->ProcessMemoryRead(addressInfo, _gameboy->GetMasterClock());
+				if(result != ReadResult::Normal) {
+					//Memory access was a read on an uninitialized memory address
+					if(result == ReadResult::FirstUninitRead) {
+						//Only warn the first time
+						_debugger->Log("[GB] Uninitialized memory read: $" + HexUtilities::ToHex((uint16_t)addr));
+					}
+					if(_settings->CheckDebuggerFlag(DebuggerFlags::GbDebuggerEnabled) && _settings->GetDebugConfig().BreakOnUninitRead) {
+						_step->Break(BreakSource::BreakOnUninitMemoryRead);
+					}
 				}
 			}
 		}
 
-		if(addr == 0xFFFF || (addr >= 0xFE00 && addr < 0xFF80) || (addr >= 0x8000 && addr <= 0x9FFF)) {
+		if(CheckHookFlag(DebuggerHookFlags::EventViewer) && (addr == 0xFFFF || (addr >= 0xFE00 && addr < 0xFF80) || (addr >= 0x8000 && addr <= 0x9FFF))) {
 			_eventManager->AddEvent(DebugEventType::Register, operation);
 		}
 		_debugger->ProcessBreakConditions(CpuType::Gameboy, *_step.get(), _breakpointManager.get(), operation, addressInfo);
@@ -202,11 +208,40 @@ void GbDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType
 		_traceLogger->LogNonExec(operation, addressInfo);
 	}
 
-	if(addr == 0xFFFF || (addr >= 0xFE00 && addr < 0xFF80) || (addr >= 0x8000 && addr <= 0x9FFF)) {
+	if(CheckHookFlag(DebuggerHookFlags::EventViewer) && (addr == 0xFFFF || (addr >= 0xFE00 && addr < 0xFF80) || (addr >= 0x8000 && addr <= 0x9FFF))) {
 		_eventManager->AddEvent(DebugEventType::Register, operation);
 	}
 
-	_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _gameboy->GetMasterClock());
+	if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+		_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _gameboy->GetMasterClock());
+	}
+}
+
+void GbDebugger::ProcessCdlRead(uint32_t addr, uint8_t value, MemoryOperationType type)
+{
+	InstructionProgress.LastMemOperation = MemoryOperationInfo(addr, value, type, MemoryType::GameboyMemory);
+	if(type == MemoryOperationType::ExecOpCode) {
+		return;
+	}
+
+	AddressInfo addressInfo = _gameboy->GetAbsoluteAddress(addr);
+	if(addressInfo.Address >= 0 && addressInfo.Type == MemoryType::GbPrgRom) {
+		if(type == MemoryOperationType::ExecOperand) {
+			_codeDataLogger->SetCode(addressInfo.Address);
+		} else {
+			_codeDataLogger->SetData(addressInfo.Address);
+		}
+	}
+}
+
+void GbDebugger::ProcessCdlWrite(uint32_t addr, uint8_t value, MemoryOperationType type)
+{
+	InstructionProgress.LastMemOperation = MemoryOperationInfo(addr, value, type, MemoryType::GameboyMemory);
+
+	AddressInfo addressInfo = _gameboy->GetAbsoluteAddress(addr);
+	if(addressInfo.Type == MemoryType::GbWorkRam || addressInfo.Type == MemoryType::GbCartRam || addressInfo.Type == MemoryType::GbHighRam) {
+		_disassembler->InvalidateCache(addressInfo, CpuType::Gameboy);
+	}
 }
 
 void GbDebugger::Run()
@@ -300,7 +335,9 @@ void GbDebugger::ProcessPpuRead(uint16_t addr, uint8_t value, MemoryType memoryT
 	MemoryOperationInfo operation(addr, value, MemoryOperationType::Read, memoryType);
 	AddressInfo addressInfo { addr, memoryType };
 	_debugger->ProcessBreakConditions(CpuType::Gameboy, *_step.get(), _breakpointManager.get(), operation, addressInfo);
-	_memoryAccessCounter->ProcessMemoryRead(addressInfo, _gameboy->GetMasterClock());
+	if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+		_memoryAccessCounter->ProcessMemoryRead(addressInfo, _gameboy->GetMasterClock());
+	}
 }
 
 void GbDebugger::ProcessPpuWrite(uint16_t addr, uint8_t value, MemoryType memoryType)
@@ -308,7 +345,9 @@ void GbDebugger::ProcessPpuWrite(uint16_t addr, uint8_t value, MemoryType memory
 	MemoryOperationInfo operation(addr, value, MemoryOperationType::Write, memoryType);
 	AddressInfo addressInfo { addr, memoryType };
 	_debugger->ProcessBreakConditions(CpuType::Gameboy, *_step.get(), _breakpointManager.get(), operation, addressInfo);
-	_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _gameboy->GetMasterClock());
+	if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+		_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _gameboy->GetMasterClock());
+	}
 }
 
 void GbDebugger::ProcessPpuCycle()
@@ -59,6 +59,8 @@ public:
 	void ProcessInstruction();
 	void ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType type);
 	void ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType type);
+	void ProcessCdlRead(uint32_t addr, uint8_t value, MemoryOperationType type);
+	void ProcessCdlWrite(uint32_t addr, uint8_t value, MemoryOperationType type);
 	void ProcessInterrupt(uint32_t originalPc, uint32_t currentPc, bool forNmi) override;
 	void ProcessPpuRead(uint16_t addr, uint8_t value, MemoryType memoryType);
 	void ProcessPpuWrite(uint16_t addr, uint8_t value, MemoryType memoryType);
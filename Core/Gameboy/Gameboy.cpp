@@ -153,6 +153,7 @@ void Gameboy::PowerOn(SuperGameboy *sgb)
 
 void Gameboy::Run(uint64_t runUntilClock)
 {
+	_cpu->SetCycleLimit(runUntilClock);
 	while(_cpu->GetCycleCount() < runUntilClock) {
 		_cpu->Exec();
 	}
@@ -504,6 +505,7 @@ GameboyModel Gameboy::GetEffectiveModel(GameboyHeader& header)
 
 void Gameboy::RunFrame()
 {
+	_cpu->SetCycleLimit(UINT64_MAX);
 	uint32_t frameCount = _ppu->GetFrameCount();
 	while(frameCount == _ppu->GetFrameCount()) {
 		_cpu->Exec();
@@ -513,7 +515,7 @@ void Gameboy::RunFrame()
 void Gameboy::ProcessEndOfFrame()
 {
 	_controlManager->UpdateControlDevices();
-	_controlManager->UpdateInputState();
+	_controlManager->RequestInputUpdate();
 	_apu->Run();
 }
 
@@ -103,6 +103,9 @@ void GbCpu::Exec()
 			_emu->ProcessHaltedCpu<CpuType::Gameboy>();
 			if(_state.HaltCounter > 1) {
 				ProcessCgbSpeedSwitch();
+			} else if(!_state.Stopped && !_emu->IsDebugging()) {
+				RunHaltedCycles();
+				return;
 			}
 #endif
 		}
@@ -150,6 +153,17 @@ void GbCpu::ProcessNextCycleStart()
 	}
 }
 
+void GbCpu::RunHaltedCycles()
+{
+	//Nothing can happen on the CPU side until an IRQ is requested, so run the halted cycles
+	//in a tight loop rather than going through Exec() for each one. The loop also stops at the
+	//end of the frame and at the cycle limit (used by the SGB to keep the GB in sync with the SNES)
+	uint32_t frameCount = _ppu->GetFrameCount();
+	do {
+		ProcessNextCycleStart();
+	} while(!_prevIrqVector && frameCount == _ppu->GetFrameCount() && _state.CycleCount < _cycleLimit);
+}
+
 void GbCpu::ProcessHaltBug()
 {
 	if(_state.EiPending) {
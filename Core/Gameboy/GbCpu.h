@@ -30,6 +30,7 @@ private:
 	GbPpu* _ppu = nullptr;
 
 	uint8_t _prevIrqVector = 0;
+	uint64_t _cycleLimit = UINT64_MAX;
 
 	void ExecOpCode(uint8_t opCode);
 
@@ -160,6 +161,7 @@ private:
 	
 	__forceinline void ProcessNextCycleStart();
 	__noinline bool HandleStoppedState();
+	__noinline void RunHaltedCycles();
 
 public:
 	virtual ~GbCpu();
@@ -170,6 +172,7 @@ public:
 	bool IsHalted();
 
 	uint64_t GetCycleCount() { return _state.CycleCount; }
+	void SetCycleLimit(uint64_t cycleLimit) { _cycleLimit = cycleLimit; }
 
 	void Exec();
 	void PowerOn();
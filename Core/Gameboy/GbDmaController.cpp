@@ -88,6 +88,12 @@ bool GbDmaController::IsOamDmaRunning()
 	return _state.OamDmaRunning;
 }
 
+bool GbDmaController::IsOamDmaPending()
+{
+	//True if an OAM DMA is running, or is about to start/restart
+	return _state.OamDmaRunning || _state.DmaCounter > 0 || _state.DmaStartDelay > 0;
+}
+
 uint16_t GbDmaController::GetOamReadAddress()
 {
 	return (_state.InternalDest << 8) + (160 - _state.DmaCounter);
@@ -100,6 +106,8 @@ uint8_t GbDmaController::Read()
 
 void GbDmaController::Write(uint8_t value)
 {
+	//The PPU's sprite fetcher behaves differently while OAM DMA is running
+	_ppu->CancelBulkDraw();
 	_state.DmaStartDelay = 1;
 	_state.OamDmaSource = value;
 }
@@ -337,6 +337,7 @@ uint8_t GbMemoryManager::ReadRegister(uint16_t addr)
 			//00-0F
 			switch(addr) {
 				case 0xFF00:
+					_controlManager->ProcessPendingInputUpdate();
 					_controlManager->SetInputReadFlag();
 					return _controlManager->ReadInputPort();
 				
@@ -439,7 +440,10 @@ void GbMemoryManager::WriteRegister(uint16_t addr, uint8_t value)
 		} else {
 			//00-0F
 			switch(addr) {
-				case 0xFF00: _controlManager->WriteInputPort(value); break;
+				case 0xFF00:
+					_controlManager->ProcessPendingInputUpdate();
+					_controlManager->WriteInputPort(value);
+					break;
 				case 0xFF01: _state.SerialData = value; break; //FF01 - SB - Serial transfer data (R/W)
 				case 0xFF02: 
 					//FF02 - SC - Serial Transfer Control (R/W)
@@ -45,6 +45,7 @@ void GbPpu::Init(Emulator* emu, Gameboy* gameboy, GbMemoryManager* memoryManager
 	_state.Mode = PpuMode::HBlank;
 	_state.CgbEnabled = _gameboy->IsCgb();
 	_lastFrameTime = 0;
+	_bulkDrawActive = false;
 
 	UpdatePalette();
 
@@ -87,6 +88,8 @@ uint16_t* GbPpu::GetPreviousEventViewerBuffer()
 
 void GbPpu::SetCpuStopState(bool stopped)
 {
+	CancelBulkDraw();
+
 	if(!_gameboy->IsCgb()) {
 		if(stopped) {
 			_lcdDisabled = true;
@@ -155,8 +158,14 @@ void GbPpu::ExecCycle()
 	}
 
 	if(_state.Mode == PpuMode::Drawing) {
-		RunDrawCycle();
-		if(_drawnPixels == 160) {
+		if(!_bulkDrawActive) {
+			RunDrawCycle();
+		} else if(_state.Cycle == _bulkDrawEndCycle) {
+			//The scanline was drawn ahead of time, the last pixel is output on this cycle
+			_bulkDrawActive = false;
+		}
+
+		if(_drawnPixels == 160 && !_bulkDrawActive) {
 			//Mode turns to hblank on the same cycle as the last pixel is output
 			_state.Mode = PpuMode::HBlank;
 			_state.IrqMode = PpuMode::HBlank;
@@ -348,6 +357,7 @@ void GbPpu::ProcessVisibleScanline()
 				_rendererIdle = false;
 				//"at some point in this frame the value of WY was equal to LY"
 				_wyEnableFlag |= _state.Scanline == _state.WindowY && _state.WindowEnabled;
+				StartBulkDraw();
 			}
 			break;
 
@@ -356,6 +366,7 @@ void GbPpu::ProcessVisibleScanline()
 				_rendererIdle = false;
 				//"at some point in this frame the value of WY was equal to LY"
 				_wyEnableFlag |= _state.Scanline == _state.WindowY && _state.WindowEnabled;
+				StartBulkDraw();
 			}
 			break;
 
@@ -374,6 +385,9 @@ void GbPpu::ProcessVisibleScanline()
 void GbPpu::ProcessPpuCycle()
 {
 	if(_emu->IsDebugging()) {
+		//The debugger needs to see the renderer's state on each dot
+		CancelBulkDraw();
+
 		_emu->ProcessPpuCycle<CpuType::Gameboy>();
 		if(_state.Mode != PpuMode::Drawing) {
 			_currentEventViewerBuffer[456 * _state.Scanline + _state.Cycle] = evtColors[(int)_state.Mode];
@@ -485,6 +499,95 @@ void GbPpu::RunDrawCycle()
 	ClockTileFetcher();
 }
 
+void GbPpu::StartBulkDraw()
+{
+	//Most games never change the PPU's state during mode 3, in which case the entire scanline can be drawn
+	//at once, and the PPU stays idle until the cycle where the last pixel would have been output (the mode 3
+	//length and the STAT mode/IRQ timing are identical to the dot-by-dot renderer's).
+	//Any write that can affect rendering before that calls CancelBulkDraw(), which replays the scanline
+	//dot-by-dot up to the current cycle - the rest of the scanline then runs normally.
+	if(_emu->IsDebugging() || _dmaController->IsOamDmaPending() || _gbcTileGlitch) {
+		return;
+	}
+
+	SaveDrawState();
+
+	//Mode 3 can't overlap the end of the scanline, use the dot-by-dot renderer if this ever happens
+	uint16_t maxDots = 456 - _state.Cycle - 1;
+	uint16_t dots = 0;
+	while(_drawnPixels < 160) {
+		if(dots == maxDots) {
+			RestoreDrawState();
+			return;
+		}
+		RunDrawCycle();
+		dots++;
+	}
+
+	_bulkDrawActive = true;
+	_bulkDrawStartCycle = _state.Cycle;
+	_bulkDrawEndCycle = _state.Cycle + dots - 1;
+	_state.IdleCycles = dots > 1 ? dots - 2 : 0;
+}
+
+void GbPpu::CancelBulkDraw()
+{
+	if(!_bulkDrawActive) {
+		return;
+	}
+
+	_bulkDrawActive = false;
+	_state.IdleCycles = 0;
+
+	//Run the scanline again, one dot at a time, until it reaches the current cycle (this cycle's dot has already run)
+	RestoreDrawState();
+	for(uint16_t cycle = _bulkDrawStartCycle; cycle <= _state.Cycle; cycle++) {
+		RunDrawCycle();
+	}
+}
+
+void GbPpu::SaveDrawState()
+{
+	DrawState& s = _bulkDrawState;
+	s.BgFifo = _bgFifo;
+	s.BgFetcher = _bgFetcher;
+	s.OamFifo = _oamFifo;
+	s.OamFetcher = _oamFetcher;
+	s.DrawnPixels = _drawnPixels;
+	s.FetchColumn = _fetchColumn;
+	s.FetchWindow = _fetchWindow;
+	s.WindowCounter = _windowCounter;
+	s.WxEnableFlag = _wxEnableFlag;
+	s.InsertGlitchBgPixel = _insertGlitchBgPixel;
+	s.FetchSprite = _fetchSprite;
+	memcpy(s.SpriteX, _spriteX, sizeof(_spriteX));
+	memcpy(s.OamReadBuffer, _oamReadBuffer, sizeof(_oamReadBuffer));
+	s.TileIndex = _tileIndex;
+	s.LastPixelType = _lastPixelType;
+	s.LastBgColor = _lastBgColor;
+}
+
+void GbPpu::RestoreDrawState()
+{
+	DrawState& s = _bulkDrawState;
+	_bgFifo = s.BgFifo;
+	_bgFetcher = s.BgFetcher;
+	_oamFifo = s.OamFifo;
+	_oamFetcher = s.OamFetcher;
+	_drawnPixels = s.DrawnPixels;
+	_fetchColumn = s.FetchColumn;
+	_fetchWindow = s.FetchWindow;
+	_windowCounter = s.WindowCounter;
+	_wxEnableFlag = s.WxEnableFlag;
+	_insertGlitchBgPixel = s.InsertGlitchBgPixel;
+	_fetchSprite = s.FetchSprite;
+	memcpy(_spriteX, s.SpriteX, sizeof(_spriteX));
+	memcpy(_oamReadBuffer, s.OamReadBuffer, sizeof(_oamReadBuffer));
+	_tileIndex = s.TileIndex;
+	_lastPixelType = s.LastPixelType;
+	_lastBgColor = s.LastBgColor;
+}
+
 void GbPpu::WriteBgPixel(uint8_t colorIndex)
 {
 	uint16_t outOffset = _state.Scanline * GbConstants::ScreenWidth + _drawnPixels;
@@ -892,6 +995,8 @@ uint8_t GbPpu::Read(uint16_t addr)
 
 void GbPpu::Write(uint16_t addr, uint8_t value)
 {
+	CancelBulkDraw();
+
 	switch(addr) {
 		case 0xFF40:
 			_state.Control = value; 
@@ -1009,6 +1114,7 @@ void GbPpu::Write(uint16_t addr, uint8_t value)
 
 void GbPpu::SetTileFetchGlitchState(bool enabled)
 {
+	CancelBulkDraw();
 	_gbcTileGlitch = enabled;
 }
 
@@ -1041,6 +1147,7 @@ uint8_t GbPpu::PeekVram(uint16_t addr)
 
 void GbPpu::WriteVram(uint16_t addr, uint8_t value)
 {
+	CancelBulkDraw();
 	if(IsVramWriteAllowed()) {
 		uint16_t vramAddr = (_state.CgbVramBank << 13) | (addr & 0x1FFF);
 		_emu->ProcessPpuWrite<CpuType::Gameboy>(vramAddr, value, MemoryType::GbVideoRam);
@@ -1091,6 +1198,7 @@ void GbPpu::WriteOam(uint8_t addr, uint8_t value, bool forDma)
 	//The DMA controller is always allowed to write to OAM (presumably the PPU can't read OAM during that time? TODO implement)
 	//On the DMG, there is a 4 clock gap (80 to 83) between OAM evaluation & rendering where writing is allowed
 	if(addr < 0xA0) {
+		CancelBulkDraw();
 		if(forDma) {
 			_oam[addr] = value;
 			_emu->ProcessPpuWrite<CpuType::Gameboy>(addr, value, MemoryType::GbSpriteRam);
@@ -1197,6 +1305,8 @@ void GbPpu::WriteCgbRegister(uint16_t addr, uint8_t value)
 		return;
 	}
 
+	CancelBulkDraw();
+
 	switch(addr) {
 		case 0xFF4C: _state.CgbEnabled = (value & 0x0C) == 0; break;
 		case 0xFF4F: _state.CgbVramBank = value & 0x01; break;
@@ -1255,6 +1365,9 @@ void GbPpu::WriteCgbPalette(uint8_t& pos, uint16_t* pal, bool autoInc, uint8_t v
 
 void GbPpu::Serialize(Serializer& s)
 {
+	//Save states always contain the dot-by-dot renderer's state
+	CancelBulkDraw();
+
 	SV(_state.Scanline); SV(_state.Cycle); SV(_state.Mode); SV(_state.LyCompare); SV(_state.BgPalette); SV(_state.ObjPalette0); SV(_state.ObjPalette1);
 	SV(_state.ScrollX); SV(_state.ScrollY); SV(_state.WindowX); SV(_state.WindowY); SV(_state.Control); SV(_state.LcdEnabled); SV(_state.WindowTilemapSelect);
 	SV(_state.WindowEnabled); SV(_state.BgTileSelect); SV(_state.BgTilemapSelect); SV(_state.LargeSprites); SV(_state.SpritesEnabled); SV(_state.BgEnabled);
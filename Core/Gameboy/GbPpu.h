@@ -70,6 +70,32 @@ private:
 	GbPixelType _lastPixelType = {};
 	uint8_t _lastBgColor = 0;
 
+	//Renderer state at the start of a scanline that was drawn ahead of time (used to replay the scanline one dot at a time)
+	struct DrawState
+	{
+		GbPpuFifo BgFifo;
+		GbPpuFetcher BgFetcher;
+		GbPpuFifo OamFifo;
+		GbPpuFetcher OamFetcher;
+		int16_t DrawnPixels;
+		uint8_t FetchColumn;
+		bool FetchWindow;
+		int16_t WindowCounter;
+		bool WxEnableFlag;
+		bool InsertGlitchBgPixel;
+		int16_t FetchSprite;
+		uint8_t SpriteX[10];
+		uint8_t OamReadBuffer[2];
+		uint8_t TileIndex;
+		GbPixelType LastPixelType;
+		uint8_t LastBgColor;
+	};
+
+	DrawState _bulkDrawState = {};
+	bool _bulkDrawActive = false;
+	uint16_t _bulkDrawStartCycle = 0;
+	uint16_t _bulkDrawEndCycle = 0;
+
 	__forceinline void WriteBgPixel(uint8_t colorIndex);
 	__forceinline void WriteObjPixel(uint8_t colorIndex);
 
@@ -80,6 +106,9 @@ private:
 	void ProcessFirstScanlineAfterPowerOn();
 	__forceinline void ProcessVisibleScanline();
 	__forceinline void RunDrawCycle();
+	void StartBulkDraw();
+	void SaveDrawState();
+	void RestoreDrawState();
 	__forceinline void RunSpriteEvaluation();
 	void ResetRenderer();
 	void ClockSpriteFetcher();
@@ -128,6 +157,7 @@ public:
 	void Write(uint16_t addr, uint8_t value);
 
 	void SetTileFetchGlitchState(bool enabled);
+	void CancelBulkDraw();
 
 	bool IsVramReadAllowed();
 	bool IsVramWriteAllowed();
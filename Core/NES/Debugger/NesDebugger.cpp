@@ -158,7 +158,7 @@ void NesDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 	MemoryOperationInfo operation(addr, value, type, MemoryType::NesMemory);
 	InstructionProgress.LastMemOperation = operation;
 
-	if(IsRegister(operation)) {
+	if(CheckHookFlag(DebuggerHookFlags::EventViewer) && IsRegister(operation)) {
 		_eventManager->AddEvent(DebugEventType::Register, operation);
 	}
 
@@ -169,7 +169,9 @@ void NesDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 			_traceLogger->Log(state, disInfo, operation, addressInfo);
 		}
 
-		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _cpu->GetCycleCount());
+		if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+			_memoryAccessCounter->ProcessMemoryExec(addressInfo, _cpu->GetCycleCount());
+		}
 		if(_step->ProcessCpuCycle()) {
 			_debugger->SleepUntilResume(CpuType::Nes, BreakSource::CpuStep, &operation);
 		}
@@ -181,13 +183,17 @@ void NesDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 		if(_traceLogger->IsEnabled()) {
 			_traceLogger->LogNonExec(operation, addressInfo);
 		}
-		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _cpu->GetCycleCount());
+		if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+			_memoryAccessCounter->ProcessMemoryExec(addressInfo, _cpu->GetCycleCount());
+		}
 		_step->ProcessCpuCycle();
 		_debugger->ProcessBreakConditions(CpuType::Nes, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 	} else {
 		if(operation.Type == MemoryOperationType::DmaRead) {
 			bool isDmcDma = _cpu->IsDmcDma();
-			_eventManager->AddEvent(isDmcDma ? DebugEventType::DmcDmaRead : DebugEventType::DmaRead, operation);
+			if(CheckHookFlag(DebuggerHookFlags::EventViewer)) {
+				_eventManager->AddEvent(isDmcDma ? DebugEventType::DmcDmaRead : DebugEventType::DmaRead, operation);
+			}
 			if(isDmcDma && addressInfo.Type == MemoryType::NesPrgRom && addressInfo.Address >= 0) {
 				_codeDataLogger->SetData<NesCdlFlags::PcmData>(addressInfo.Address);
 			}
@@ -199,15 +205,17 @@ void NesDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 			_traceLogger->LogNonExec(operation, addressInfo);
 		}
 
-		ReadResult result = _memoryAccessCounter->ProcessMemoryRead(addressInfo, _cpu->GetCycleCount());
-		if(result != ReadResult::Normal && operation.Type != MemoryOperationType::DummyRead) {
-			//Memory access was a read on an uninitialized memory address
-			if(result == ReadResult::FirstUninitRead) {
-				//Only warn the first time
-				_debugger->Log("[CPU] Uninitialized memory read: $" + HexUtilities::ToHex((uint16_t)addr));
-			}
-			if(_settings->CheckDebuggerFlag(DebuggerFlags::NesDebuggerEnabled) && _settings->GetDebugConfig().BreakOnUninitRead) {
-				_step->Break(BreakSource::BreakOnUninitMemoryRead);
+		if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+			ReadResult result = _memoryAccessCounter->ProcessMemoryRead(addressInfo, _cpu->GetCycleCount());
+			if(result != ReadResult::Normal && operation.Type != MemoryOperationType::DummyRead) {
+				//Memory access was a read on an uninitialized memory address
+				if(result == ReadResult::FirstUninitRead) {
+					//Only warn the first time
+					_debugger->Log("[CPU] Uninitialized memory read: $" + HexUtilities::ToHex((uint16_t)addr));
+				}
+				if(_settings->CheckDebuggerFlag(DebuggerFlags::NesDebuggerEnabled) && _settings->GetDebugConfig().BreakOnUninitRead) {
+					_step->Break(BreakSource::BreakOnUninitMemoryRead);
+				}
 			}
 		}
 		_step->ProcessCpuCycle();
@@ -225,7 +233,7 @@ void NesDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType
 		_disassembler->InvalidateCache(addressInfo, CpuType::Nes);
 	}
 
-	if(IsRegister(operation)) {
+	if(CheckHookFlag(DebuggerHookFlags::EventViewer) && IsRegister(operation)) {
 		_eventManager->AddEvent(DebugEventType::Register, operation);
 	}
 
@@ -233,11 +241,44 @@ void NesDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType
 		_traceLogger->LogNonExec(operation, addressInfo);
 	}
 
-	_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _cpu->GetCycleCount());
+	if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+		_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _cpu->GetCycleCount());
+	}
 	_step->ProcessCpuCycle();
 	_debugger->ProcessBreakConditions(CpuType::Nes, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 }
 
+void NesDebugger::ProcessCdlRead(uint32_t addr, uint8_t value, MemoryOperationType type)
+{
+	InstructionProgress.LastMemOperation = MemoryOperationInfo(addr, value, type, MemoryType::NesMemory);
+	if(type == MemoryOperationType::ExecOpCode || type == MemoryOperationType::DummyRead) {
+		return;
+	}
+
+	AddressInfo addressInfo = _mapper->GetAbsoluteAddress(addr);
+	if(addressInfo.Type == MemoryType::NesPrgRom && addressInfo.Address >= 0) {
+		if(type == MemoryOperationType::ExecOperand) {
+			_codeDataLogger->SetCode(addressInfo.Address);
+		} else if(type == MemoryOperationType::DmaRead) {
+			if(_cpu->IsDmcDma()) {
+				_codeDataLogger->SetData<NesCdlFlags::PcmData>(addressInfo.Address);
+			}
+		} else {
+			_codeDataLogger->SetData(addressInfo.Address);
+		}
+	}
+}
+
+void NesDebugger::ProcessCdlWrite(uint32_t addr, uint8_t value, MemoryOperationType type)
+{
+	InstructionProgress.LastMemOperation = MemoryOperationInfo(addr, value, type, MemoryType::NesMemory);
+
+	AddressInfo addressInfo = _mapper->GetAbsoluteAddress(addr);
+	if(addressInfo.Address >= 0 && (addressInfo.Type == MemoryType::NesInternalRam || addressInfo.Type == MemoryType::NesWorkRam || addressInfo.Type == MemoryType::NesSaveRam)) {
+		_disassembler->InvalidateCache(addressInfo, CpuType::Nes);
+	}
+}
+
 void NesDebugger::Run()
 {
 	_step.reset(new StepRequest());
@@ -332,7 +373,9 @@ void NesDebugger::ProcessPpuRead(uint16_t addr, uint8_t value, MemoryType memory
 		_chrRomCdl->SetCode(addressInfo.Address);
 	}
 	_debugger->ProcessBreakConditions(CpuType::Nes, *_step.get(), _breakpointManager.get(), operation, addressInfo);
-	_memoryAccessCounter->ProcessMemoryRead(addressInfo, _console->GetMasterClock());
+	if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+		_memoryAccessCounter->ProcessMemoryRead(addressInfo, _console->GetMasterClock());
+	}
 }
 
 void NesDebugger::ProcessPpuWrite(uint16_t addr, uint8_t value, MemoryType memoryType)
@@ -343,7 +386,9 @@ void NesDebugger::ProcessPpuWrite(uint16_t addr, uint8_t value, MemoryType memor
 		_mapper->GetPpuAbsoluteAddress(addr, addressInfo);
 	}
 	_debugger->ProcessBreakConditions(CpuType::Nes, *_step.get(), _breakpointManager.get(), operation, addressInfo);
-	_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _console->GetMasterClock());
+	if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+		_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _console->GetMasterClock());
+	}
 }
 
 void NesDebugger::ProcessPpuCycle()
@@ -236,6 +236,7 @@ void NesControlManager::SaveBattery()
 
 uint8_t NesControlManager::ReadRam(uint16_t addr)
 {
+	ProcessPendingInputUpdate();
 	SetInputReadFlag();
 
 	uint8_t value = _console->GetMemoryManager()->GetOpenBus(GetOpenBusMask(addr - 0x4016));
@@ -250,6 +251,9 @@ uint8_t NesControlManager::ReadRam(uint16_t addr)
 
 void NesControlManager::WriteRam(uint16_t addr, uint8_t value)
 {
+	//Writes to $4016 latch the controllers' state
+	ProcessPendingInputUpdate();
+
 	for(shared_ptr<BaseControlDevice> &device : _controlDevices) {
 		if(device->IsConnected()) {
 			device->WriteRam(addr, value);
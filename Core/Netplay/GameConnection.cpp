@@ -59,6 +59,7 @@ NetMessage* GameConnection::ReadMessage()
 	if(_readPosition > 4) {
 		uint32_t messageLength;
 		if(ExtractMessage(_messageBuffer, messageLength)) {
+			_messageLength = messageLength;
 			switch((MessageType)_messageBuffer[0]) {
 				case MessageType::HandShake: return new HandShakeMessage(_messageBuffer, messageLength);
 				case MessageType::SaveState: return new SaveStateMessage(_messageBuffer, messageLength);
@@ -81,6 +82,19 @@ void GameConnection::SendNetMessage(NetMessage &message)
 	message.Send(*_socket.get());
 }
 
+void GameConnection::SendRawMessage(const string &packetData)
+{
+	//Sends a packet that was already serialized (e.g by NetMessage::GetPacketData), used to send the same data to several connections
+	auto lock = _socketLock.AcquireSafe();
+	_socket->Send((char*)packetData.c_str(), (int)packetData.size(), 0);
+}
+
+string GameConnection::GetRawMessage()
+{
+	//Returns the packet for the message currently being processed (length prefix + message type + content)
+	return string((char*)&_messageLength, 4) + string((char*)_messageBuffer, _messageLength);
+}
+
 void GameConnection::Disconnect()
 {
 	auto lock = _socketLock.AcquireSafe();
@@ -17,6 +17,7 @@ protected:
 	uint8_t _readBuffer[GameConnection::MaxMsgLength] = {};
 	uint8_t _messageBuffer[GameConnection::MaxMsgLength] = {};
 	int _readPosition = 0;
+	uint32_t _messageLength = 0;
 	SimpleLock _socketLock;
 
 private:
@@ -29,6 +30,7 @@ private:
 
 protected:
 	void Disconnect();
+	string GetRawMessage();
 
 public:
 	static constexpr uint8_t SpectatorPort = 0xFF;
@@ -38,4 +40,5 @@ public:
 	bool ConnectionError();
 	void ProcessMessages();
 	void SendNetMessage(NetMessage &message);
+	void SendRawMessage(const string &packetData);
 };
\ No newline at end of file
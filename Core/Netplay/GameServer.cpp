@@ -2,6 +2,7 @@
 #include "Netplay/GameServer.h"
 #include "Netplay/GameServerConnection.h"
 #include "Netplay/PlayerListMessage.h"
+#include "Netplay/MovieDataMessage.h"
 #include "Shared/Emulator.h"
 #include "Shared/BaseControlManager.h"
 #include "Shared/NotificationManager.h"
@@ -84,11 +85,18 @@ bool GameServer::SetInput(BaseControlDevice *device)
 
 void GameServer::RecordInput(vector<shared_ptr<BaseControlDevice>> devices)
 {
+	if(_openConnections.empty()) {
+		return;
+	}
+
 	for(shared_ptr<BaseControlDevice> &device : devices) {
+		//Serialize the message once and send the same packet to every connection
+		MovieDataMessage message(device->GetRawState(), device->GetPort());
+		string packetData = message.GetPacketData();
 		for(unique_ptr<GameServerConnection>& connection : _openConnections) {
 			if(!connection->ConnectionError()) {
 				//Send movie stream
-				connection->SendMovieData(device->GetPort(), device->GetRawState());
+				connection->SendMovieData(packetData);
 			}
 		}
 	}
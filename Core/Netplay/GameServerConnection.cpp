@@ -1,5 +1,4 @@
 #include "pch.h"
-#include <random>
 #include "Netplay/GameServerConnection.h"
 #include "Netplay/HandShakeMessage.h"
 #include "Netplay/InputDataMessage.h"
@@ -35,18 +34,9 @@ GameServerConnection::~GameServerConnection()
 
 void GameServerConnection::SendServerInformation()
 {
-	std::random_device rd;
-	std::mt19937 engine(rd());
-	std::uniform_int_distribution<> dist((int)' ', (int)'~');
-	string hash(50, ' ');
-	for(int i = 0; i < 50; i++) {
-		int random = dist(engine);
-		hash[i] = (char)random;
-	}
-
-	_connectionHash = hash;
+	_connectionHash = ServerInformationMessage::GenerateHashSalt();
 
-	ServerInformationMessage message(hash);
+	ServerInformationMessage message(_connectionHash);
 	SendNetMessage(message);
 }
 
@@ -60,11 +50,10 @@ void GameServerConnection::SendGameInformation()
 	SendNetMessage(saveState);
 }
 
-void GameServerConnection::SendMovieData(uint8_t port, ControlDeviceState state)
+void GameServerConnection::SendMovieData(const string& packetData)
 {
 	if(_handshakeCompleted) {
-		MovieDataMessage message(state, port);
-		SendNetMessage(message);
+		SendRawMessage(packetData);
 	}
 }
 
@@ -43,7 +43,7 @@ public:
 	virtual ~GameServerConnection();
 
 	ControlDeviceState GetState();
-	void SendMovieData(uint8_t port, ControlDeviceState state);
+	void SendMovieData(const string& packetData);
 
 	NetplayControllerInfo GetControllerPort();
 
@@ -40,7 +40,7 @@ public:
 		return _type;
 	}
 
-	void Send(Socket &socket)
+	string GetPacketData()
 	{
 		Serializer s(SaveStateManager::FileFormatVersion, true);
 		Serialize(s);
@@ -50,7 +50,12 @@ public:
 
 		string data = out.str();
 		uint32_t messageLength = (uint32_t)data.size() + 1;
-		data = string((char*)&messageLength, 4) + (char)_type + data;
+		return string((char*)&messageLength, 4) + (char)_type + data;
+	}
+
+	void Send(Socket &socket)
+	{
+		string data = GetPacketData();
 		socket.Send((char*)data.c_str(), (int)data.size(), 0);
 	}
 
@@ -0,0 +1,48 @@
+#include "pch.h"
+#include "Netplay/RelayClientConnection.h"
+#include "Netplay/SpectatorRelay.h"
+#include "Netplay/NetplayTypes.h"
+#include "Netplay/HandShakeMessage.h"
+#include "Netplay/SelectControllerMessage.h"
+#include "Netplay/ForceDisconnectMessage.h"
+#include "Netplay/ServerInformationMessage.h"
+#include "Shared/MessageManager.h"
+#include "Shared/Emulator.h"
+#include "Shared/EmuSettings.h"
+
+RelayClientConnection::RelayClientConnection(SpectatorRelay* relay, Emulator* emu, unique_ptr<Socket> socket, ClientConnectionData& connectionData) : GameConnection(emu, std::move(socket))
+{
+	_relay = relay;
+	_connectionData = connectionData;
+}
+
+void RelayClientConnection::SendHandshake(string serverSalt)
+{
+	//The relay always connects to the host as a spectator
+	HandShakeMessage message(HandShakeMessage::GetPasswordHash(_connectionData.Password, serverSalt), true, _emu->GetSettings()->GetVersion());
+	SendNetMessage(message);
+}
+
+void RelayClientConnection::RequestSaveState()
+{
+	//Selecting the spectator port makes the server send the game information and a new save state
+	SelectControllerMessage message(NetplayControllerInfo { GameConnection::SpectatorPort, 0 });
+	SendNetMessage(message);
+}
+
+void RelayClientConnection::ProcessMessage(NetMessage* message)
+{
+	switch(message->GetType()) {
+		case MessageType::ServerInformation:
+			SendHandshake(((ServerInformationMessage*)message)->GetHashSalt());
+			break;
+
+		case MessageType::ForceDisconnect:
+			MessageManager::Log("[Relay] " + ((ForceDisconnectMessage*)message)->GetMessage());
+			break;
+
+		default:
+			_relay->ProcessHostMessage(message->GetType(), GetRawMessage());
+			break;
+	}
+}
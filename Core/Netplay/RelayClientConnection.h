@@ -0,0 +1,24 @@
+#pragma once
+#include "pch.h"
+#include "Netplay/GameConnection.h"
+#include "Netplay/ClientConnectionData.h"
+
+class SpectatorRelay;
+
+//Connection between a spectator relay and the host's GameServer (the relay joins the host as a spectator)
+class RelayClientConnection final : public GameConnection
+{
+private:
+	SpectatorRelay* _relay = nullptr;
+	ClientConnectionData _connectionData = {};
+
+	void SendHandshake(string serverSalt);
+
+protected:
+	void ProcessMessage(NetMessage* message) override;
+
+public:
+	RelayClientConnection(SpectatorRelay* relay, Emulator* emu, unique_ptr<Socket> socket, ClientConnectionData& connectionData);
+
+	void RequestSaveState();
+};
@@ -0,0 +1,62 @@
+#include "pch.h"
+#include "Netplay/RelayServerConnection.h"
+#include "Netplay/SpectatorRelay.h"
+#include "Netplay/HandShakeMessage.h"
+#include "Netplay/ForceDisconnectMessage.h"
+#include "Netplay/ServerInformationMessage.h"
+#include "Shared/MessageManager.h"
+#include "Shared/Emulator.h"
+#include "Shared/EmuSettings.h"
+
+RelayServerConnection::RelayServerConnection(SpectatorRelay* relay, Emulator* emu, unique_ptr<Socket> socket, string relayPassword) : GameConnection(emu, std::move(socket))
+{
+	_relay = relay;
+	_relayPassword = relayPassword;
+	_connectionHash = ServerInformationMessage::GenerateHashSalt();
+
+	ServerInformationMessage message(_connectionHash);
+	SendNetMessage(message);
+}
+
+RelayServerConnection::~RelayServerConnection()
+{
+	if(_handshakeCompleted) {
+		MessageManager::Log("[Relay] Spectator disconnected.");
+	}
+}
+
+void RelayServerConnection::SendForceDisconnectMessage(string disconnectMessage)
+{
+	ForceDisconnectMessage message(disconnectMessage);
+	SendNetMessage(message);
+	Disconnect();
+}
+
+void RelayServerConnection::ProcessHandshakeResponse(HandShakeMessage* message)
+{
+	if(!message->IsValid(_emu->GetSettings()->GetVersion())) {
+		SendForceDisconnectMessage("Relay is using a different version of Mesen (" + _emu->GetSettings()->GetVersionString() + ") - you have been disconnected.");
+	} else if(!message->CheckPassword(_relayPassword, _connectionHash)) {
+		SendForceDisconnectMessage("The password you provided did not match - you have been disconnected.");
+	} else {
+		//Clients that do not request spectator mode are still only allowed to watch
+		MessageManager::Log("[Relay] Spectator connected.");
+		_handshakeCompleted = true;
+		_relay->SendCatchUpData(this);
+	}
+}
+
+void RelayServerConnection::ProcessMessage(NetMessage* message)
+{
+	switch(message->GetType()) {
+		case MessageType::HandShake:
+			if(!_handshakeCompleted) {
+				ProcessHandshakeResponse((HandShakeMessage*)message);
+			}
+			break;
+
+		default:
+			//Input and controller selection messages are ignored, spectators have no control over the game
+			break;
+	}
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include "pch.h"
+#include "Netplay/GameConnection.h"
+
+class SpectatorRelay;
+class HandShakeMessage;
+
+//Connection between a spectator relay and one of its spectators
+class RelayServerConnection final : public GameConnection
+{
+private:
+	SpectatorRelay* _relay = nullptr;
+	string _connectionHash;
+	string _relayPassword;
+	bool _handshakeCompleted = false;
+
+	void SendForceDisconnectMessage(string disconnectMessage);
+	void ProcessHandshakeResponse(HandShakeMessage* message);
+
+protected:
+	void ProcessMessage(NetMessage* message) override;
+
+public:
+	RelayServerConnection(SpectatorRelay* relay, Emulator* emu, unique_ptr<Socket> socket, string relayPassword);
+	virtual ~RelayServerConnection();
+
+	bool IsHandshakeCompleted() { return _handshakeCompleted; }
+};
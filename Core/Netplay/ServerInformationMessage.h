@@ -1,5 +1,6 @@
 #pragma once
 #include "pch.h"
+#include <random>
 #include "Netplay/NetMessage.h"
 
 class ServerInformationMessage : public NetMessage
@@ -24,4 +25,17 @@ public:
 	{
 		return _hashSalt;
 	}
+
+	static string GenerateHashSalt()
+	{
+		std::random_device rd;
+		std::mt19937 engine(rd());
+		std::uniform_int_distribution<> dist((int)' ', (int)'~');
+		string hash(50, ' ');
+		for(int i = 0; i < 50; i++) {
+			int random = dist(engine);
+			hash[i] = (char)random;
+		}
+		return hash;
+	}
 };
@@ -0,0 +1,215 @@
+#include "pch.h"
+#include "Netplay/SpectatorRelay.h"
+#include "Netplay/RelayClientConnection.h"
+#include "Netplay/RelayServerConnection.h"
+#include "Netplay/ForceDisconnectMessage.h"
+#include "Shared/Emulator.h"
+#include "Shared/MessageManager.h"
+#include "Utilities/Socket.h"
+
+SpectatorRelay::SpectatorRelay(Emulator* emu)
+{
+	_emu = emu;
+	_stop = false;
+	_running = false;
+	_spectatorCount = 0;
+}
+
+SpectatorRelay::~SpectatorRelay()
+{
+	StopRelay();
+}
+
+bool SpectatorRelay::StartRelay(ClientConnectionData& hostConnectionData, uint16_t port, string password)
+{
+	StopRelay();
+
+	unique_ptr<Socket> socket(new Socket());
+	if(!socket->Connect(hostConnectionData.Host.c_str(), hostConnectionData.Port)) {
+		MessageManager::DisplayMessage("NetPlay", "CouldNotConnect");
+		return false;
+	}
+
+	_port = port;
+	_password = password;
+	_hostConnection.reset(new RelayClientConnection(this, _emu, std::move(socket), hostConnectionData));
+
+	_gameInfoPacket.clear();
+	_playerListPacket.clear();
+	_saveStatePacket.clear();
+	_catchUpPackets.clear();
+	_keyframeRequested = false;
+	_skipNextState = false;
+
+	_stop = false;
+	_running = true;
+	_relayThread.reset(new thread(&SpectatorRelay::Exec, this));
+	return true;
+}
+
+void SpectatorRelay::StopRelay()
+{
+	if(!_relayThread) {
+		return;
+	}
+
+	_stop = true;
+	_relayThread->join();
+	_relayThread.reset();
+}
+
+bool SpectatorRelay::Started()
+{
+	return _running;
+}
+
+uint32_t SpectatorRelay::GetSpectatorCount()
+{
+	return _spectatorCount;
+}
+
+void SpectatorRelay::AcceptConnections()
+{
+	while(true) {
+		unique_ptr<Socket> socket = _listener->Accept();
+		if(!socket->ConnectionError()) {
+			_spectators.push_back(unique_ptr<RelayServerConnection>(new RelayServerConnection(this, _emu, std::move(socket), _password)));
+		} else {
+			break;
+		}
+	}
+	_listener->Listen(10);
+}
+
+void SpectatorRelay::UpdateConnections()
+{
+	for(int i = (int)_spectators.size() - 1; i >= 0; i--) {
+		if(_spectators[i]->ConnectionError()) {
+			_spectators.erase(_spectators.begin() + i);
+		} else {
+			_spectators[i]->ProcessMessages();
+		}
+	}
+	_spectatorCount = (uint32_t)_spectators.size();
+}
+
+void SpectatorRelay::Broadcast(const string& packetData)
+{
+	for(unique_ptr<RelayServerConnection>& spectator : _spectators) {
+		if(spectator->IsHandshakeCompleted() && !spectator->ConnectionError()) {
+			spectator->SendRawMessage(packetData);
+		}
+	}
+}
+
+void SpectatorRelay::RequestKeyframe()
+{
+	if(!_keyframeRequested && !_gameInfoPacket.empty()) {
+		_keyframeRequested = true;
+		_hostConnection->RequestSaveState();
+	}
+}
+
+void SpectatorRelay::ProcessHostMessage(MessageType type, const string& packetData)
+{
+	//Called on the relay thread, while processing messages received from the host
+	//The host sends the game information and save state back to back, only the state immediately
+	//following the response to our request can be skipped (any other message cancels the skip)
+	bool skipState = _skipNextState;
+	_skipNextState = false;
+
+	switch(type) {
+		case MessageType::GameInformation:
+			if(_keyframeRequested && packetData == _gameInfoPacket) {
+				//Response to our own save state request, spectators that are already connected don't need it
+				_keyframeRequested = false;
+				_skipNextState = true;
+				return;
+			}
+			_keyframeRequested = false;
+			_gameInfoPacket = packetData;
+			_saveStatePacket.clear();
+			_catchUpPackets.clear();
+			break;
+
+		case MessageType::SaveState:
+			//Movie data received before this state is no longer needed to catch up
+			_saveStatePacket = packetData;
+			_catchUpPackets.clear();
+			if(skipState) {
+				return;
+			}
+			break;
+
+		case MessageType::MovieData:
+			if(!_saveStatePacket.empty()) {
+				_catchUpPackets.push_back(packetData);
+				if(_catchUpPackets.size() >= SpectatorRelay::MaxCatchUpPackets) {
+					RequestKeyframe();
+				}
+			}
+			break;
+
+		case MessageType::PlayerList:
+			_playerListPacket = packetData;
+			break;
+
+		default:
+			//Other message types are not meant to be sent to spectators
+			return;
+	}
+
+	Broadcast(packetData);
+}
+
+void SpectatorRelay::SendCatchUpData(RelayServerConnection* spectator)
+{
+	//Send the same sequence of messages a spectator would have received from the host since the last save state
+	if(!_gameInfoPacket.empty()) {
+		spectator->SendRawMessage(_gameInfoPacket);
+	}
+	if(!_saveStatePacket.empty()) {
+		spectator->SendRawMessage(_saveStatePacket);
+		for(string& packetData : _catchUpPackets) {
+			spectator->SendRawMessage(packetData);
+		}
+	}
+	if(!_playerListPacket.empty()) {
+		spectator->SendRawMessage(_playerListPacket);
+	}
+}
+
+void SpectatorRelay::Exec()
+{
+	_listener.reset(new Socket());
+	_listener->Bind(_port);
+	_listener->Listen(10);
+	MessageManager::DisplayMessage("NetPlay", "ServerStarted", std::to_string(_port));
+
+	while(!_stop) {
+		if(_hostConnection->ConnectionError()) {
+			MessageManager::DisplayMessage("NetPlay", "ConnectionLost");
+			break;
+		}
+
+		_hostConnection->ProcessMessages();
+		AcceptConnections();
+		UpdateConnections();
+
+		std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(1));
+	}
+
+	for(unique_ptr<RelayServerConnection>& spectator : _spectators) {
+		if(!spectator->ConnectionError()) {
+			ForceDisconnectMessage message("The relay has been stopped - you have been disconnected.");
+			spectator->SendNetMessage(message);
+		}
+	}
+
+	_spectators.clear();
+	_spectatorCount = 0;
+	_hostConnection.reset();
+	_listener.reset();
+	_running = false;
+	MessageManager::DisplayMessage("NetPlay", "ServerStopped");
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include "pch.h"
+#include <thread>
+#include "Netplay/MessageType.h"
+#include "Netplay/ClientConnectionData.h"
+
+class Emulator;
+class Socket;
+class RelayClientConnection;
+class RelayServerConnection;
+
+//Receives a single spectator stream from a GameServer and forwards it to any number of spectators.
+//The relay never emulates anything - it only caches the packets needed to let new spectators
+//catch up (game information, latest save state and the movie data received since that state).
+class SpectatorRelay
+{
+private:
+	//Once this many movie data packets have been received since the last save state, ask the host for a new one
+	static constexpr uint32_t MaxCatchUpPackets = 3600;
+
+	Emulator* _emu;
+	unique_ptr<thread> _relayThread;
+	unique_ptr<Socket> _listener;
+	atomic<bool> _stop;
+	atomic<bool> _running;
+	atomic<uint32_t> _spectatorCount;
+	uint16_t _port = 0;
+	string _password;
+
+	unique_ptr<RelayClientConnection> _hostConnection;
+	vector<unique_ptr<RelayServerConnection>> _spectators;
+
+	string _gameInfoPacket;
+	string _playerListPacket;
+	string _saveStatePacket;
+	vector<string> _catchUpPackets;
+	bool _keyframeRequested = false;
+	bool _skipNextState = false;
+
+	void AcceptConnections();
+	void UpdateConnections();
+	void Broadcast(const string& packetData);
+	void RequestKeyframe();
+
+	void Exec();
+
+public:
+	SpectatorRelay(Emulator* emu);
+	~SpectatorRelay();
+
+	bool StartRelay(ClientConnectionData& hostConnectionData, uint16_t port, string password);
+	void StopRelay();
+	bool Started();
+	uint32_t GetSpectatorCount();
+
+	void ProcessHostMessage(MessageType type, const string& packetData);
+	void SendCatchUpData(RelayServerConnection* spectator);
+};
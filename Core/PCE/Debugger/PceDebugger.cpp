@@ -145,7 +145,7 @@ void PceDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 	MemoryOperationInfo operation(addr, value, type, MemoryType::PceMemory);
 	InstructionProgress.LastMemOperation = operation;
 
-	if(IsRegister(operation)) {
+	if(CheckHookFlag(DebuggerHookFlags::EventViewer) && IsRegister(operation)) {
 		_eventManager->AddEvent(DebugEventType::Register, operation);
 	}
 
@@ -156,7 +156,9 @@ void PceDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 			_traceLogger->Log(state, disInfo, operation, addressInfo);
 		}
 
-		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetState().CycleCount);
+		if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+			_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetState().CycleCount);
+		}
 		if(_step->ProcessCpuCycle()) {
 			_debugger->SleepUntilResume(CpuType::Pce, BreakSource::CpuStep, &operation);
 		}
@@ -169,7 +171,9 @@ void PceDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 			_traceLogger->LogNonExec(operation, addressInfo);
 		}
 
-		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetState().CycleCount);
+		if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+			_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetState().CycleCount);
+		}
 		_step->ProcessCpuCycle();
 		_debugger->ProcessBreakConditions(CpuType::Pce, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 	} else {
@@ -181,15 +185,17 @@ void PceDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 			_traceLogger->LogNonExec(operation, addressInfo);
 		}
 
-		ReadResult result = _memoryAccessCounter->ProcessMemoryRead(addressInfo, _memoryManager->GetState().CycleCount);
-		if(result != ReadResult::Normal && operation.Type != MemoryOperationType::DummyRead) {
-			//Memory access was a read on an uninitialized memory address
-			if(result == ReadResult::FirstUninitRead) {
-				//Only warn the first time
-				_debugger->Log("[CPU] Uninitialized memory read: $" + HexUtilities::ToHex((uint16_t)addr));
-			}
-			if(_settings->CheckDebuggerFlag(DebuggerFlags::PceDebuggerEnabled) && _settings->GetDebugConfig().BreakOnUninitRead) {
-				_step->Break(BreakSource::BreakOnUninitMemoryRead);
+		if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+			ReadResult result = _memoryAccessCounter->ProcessMemoryRead(addressInfo, _memoryManager->GetState().CycleCount);
+			if(result != ReadResult::Normal && operation.Type != MemoryOperationType::DummyRead) {
+				//Memory access was a read on an uninitialized memory address
+				if(result == ReadResult::FirstUninitRead) {
+					//Only warn the first time
+					_debugger->Log("[CPU] Uninitialized memory read: $" + HexUtilities::ToHex((uint16_t)addr));
+				}
+				if(_settings->CheckDebuggerFlag(DebuggerFlags::PceDebuggerEnabled) && _settings->GetDebugConfig().BreakOnUninitRead) {
+					_step->Break(BreakSource::BreakOnUninitMemoryRead);
+				}
 			}
 		}
 		_step->ProcessCpuCycle();
@@ -207,7 +213,7 @@ void PceDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType
 		_disassembler->InvalidateCache(addressInfo, CpuType::Pce);
 	}
 
-	if(IsRegister(operation)) {
+	if(CheckHookFlag(DebuggerHookFlags::EventViewer) && IsRegister(operation)) {
 		_eventManager->AddEvent(DebugEventType::Register, operation);
 	}
 
@@ -215,11 +221,40 @@ void PceDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType
 		_traceLogger->LogNonExec(operation, addressInfo);
 	}
 
-	_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _memoryManager->GetState().CycleCount);
+	if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+		_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _memoryManager->GetState().CycleCount);
+	}
 	_step->ProcessCpuCycle();
 	_debugger->ProcessBreakConditions(CpuType::Pce, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 }
 
+void PceDebugger::ProcessCdlRead(uint32_t addr, uint8_t value, MemoryOperationType type)
+{
+	InstructionProgress.LastMemOperation = MemoryOperationInfo(addr, value, type, MemoryType::PceMemory);
+	if(type == MemoryOperationType::ExecOpCode || type == MemoryOperationType::DummyRead) {
+		return;
+	}
+
+	AddressInfo addressInfo = _memoryManager->GetAbsoluteAddress(addr);
+	if(addressInfo.Type == MemoryType::PcePrgRom && addressInfo.Address >= 0) {
+		if(type == MemoryOperationType::ExecOperand) {
+			_codeDataLogger->SetCode(addressInfo.Address);
+		} else {
+			_codeDataLogger->SetData(addressInfo.Address);
+		}
+	}
+}
+
+void PceDebugger::ProcessCdlWrite(uint32_t addr, uint8_t value, MemoryOperationType type)
+{
+	InstructionProgress.LastMemOperation = MemoryOperationInfo(addr, value, type, MemoryType::PceMemory);
+
+	AddressInfo addressInfo = _memoryManager->GetAbsoluteAddress(addr);
+	if(addressInfo.Address >= 0 && (addressInfo.Type == MemoryType::PceWorkRam || addressInfo.Type == MemoryType::PceCardRam || addressInfo.Type == MemoryType::PceCdromRam)) {
+		_disassembler->InvalidateCache(addressInfo, CpuType::Pce);
+	}
+}
+
 void PceDebugger::Run()
 {
 	_step.reset(new StepRequest());
@@ -308,7 +343,9 @@ void PceDebugger::ProcessPpuRead(uint16_t addr, uint16_t value, MemoryType memor
 	MemoryOperationInfo operation(addr, value, MemoryOperationType::Read, memoryType);
 	AddressInfo addressInfo { addr, memoryType };
 	_debugger->ProcessBreakConditions(CpuType::Pce, *_step.get(), _breakpointManager.get(), operation, addressInfo);
-	_memoryAccessCounter->ProcessMemoryRead(addressInfo, _console->GetMasterClock());
+	if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+		_memoryAccessCounter->ProcessMemoryRead(addressInfo, _console->GetMasterClock());
+	}
 }
 
 void PceDebugger::ProcessPpuWrite(uint16_t addr, uint16_t value, MemoryType memoryType)
@@ -316,7 +353,9 @@ void PceDebugger::ProcessPpuWrite(uint16_t addr, uint16_t value, MemoryType memo
 	MemoryOperationInfo operation(addr, value, MemoryOperationType::Write, memoryType);
 	AddressInfo addressInfo { addr, memoryType };
 	_debugger->ProcessBreakConditions(CpuType::Pce, *_step.get(), _breakpointManager.get(), operation, addressInfo);
-	_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _console->GetMasterClock());
+	if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+		_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _console->GetMasterClock());
+	}
 }
 
 void PceDebugger::ProcessPpuCycle()
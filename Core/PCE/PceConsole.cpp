@@ -362,7 +362,7 @@ void PceConsole::GetConsoleState(BaseState& baseState, ConsoleType consoleType)
 	state.Cpu = _cpu->GetState();
 	state.Video = GetVideoState();
 	state.MemoryManager = _memoryManager->GetState();
-	state.Timer = _timer->GetState();
+	state.Timer = _timer->GetCaughtUpState();
 	state.Psg = _psg->GetState();
 	for(int i = 0; i < 6; i++) {
 		state.PsgChannels[i] = _psg->GetChannelState(i);
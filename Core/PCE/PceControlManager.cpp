@@ -42,6 +42,7 @@ shared_ptr<BaseControlDevice> PceControlManager::CreateControllerDevice(Controll
 
 uint8_t PceControlManager::ReadInputPort()
 {
+	ProcessPendingInputUpdate();
 	SetInputReadFlag();
 
 	uint8_t result = 0;
@@ -55,6 +56,8 @@ uint8_t PceControlManager::ReadInputPort()
 
 void PceControlManager::WriteInputPort(uint8_t value)
 {
+	ProcessPendingInputUpdate();
+
 	for(shared_ptr<BaseControlDevice>& device : _controlDevices) {
 		if(device->IsConnected()) {
 			device->WriteRam(0, value);
@@ -160,31 +160,34 @@ void PceMemoryManager::UpdateCdRomBanks()
 
 void PceMemoryManager::UpdateExecCallback()
 {
+	bool slow = !_state.FastCpuSpeed;
 	if(_cdromUnitEnabled) {
 		if(_console->IsSuperGrafx()) {
-			_exec = &PceMemoryManager::ExecTemplate<true, true>;
+			_fastExec = &PceMemoryManager::ExecFast<true, true>;
+			_exec = slow ? &PceMemoryManager::ExecSlow<true, true> : _fastExec;
 		} else {
-			_exec = &PceMemoryManager::ExecTemplate<true, false>;
+			_fastExec = &PceMemoryManager::ExecFast<true, false>;
+			_exec = slow ? &PceMemoryManager::ExecSlow<true, false> : _fastExec;
 		}
 	} else {
 		if(_console->IsSuperGrafx()) {
-			_exec = &PceMemoryManager::ExecTemplate<false, true>;
+			_fastExec = &PceMemoryManager::ExecFast<false, true>;
+			_exec = slow ? &PceMemoryManager::ExecSlow<false, true> : _fastExec;
 		} else {
-			_exec = &PceMemoryManager::ExecTemplate<false, false>;
+			_fastExec = &PceMemoryManager::ExecFast<false, false>;
+			_exec = slow ? &PceMemoryManager::ExecSlow<false, false> : _fastExec;
 		}
 	}
-
-	_fastExec = _exec;
-	if(!_state.FastCpuSpeed) {
-		_exec = &PceMemoryManager::ExecSlow;
-	}
 }
 
 template<bool hasCdRom, bool isSuperGrafx>
 void PceMemoryManager::ExecTemplate()
 {
 	_state.CycleCount += 3;
-	_timer->Exec();
+	if(_state.CycleCount >= _timerIrqClock) {
+		//The timer only needs to run when its IRQ is due (or when its registers are accessed)
+		_timer->Run();
+	}
 
 	if constexpr(isSuperGrafx) {
 		_vpc->ExecSuperGrafx();
@@ -197,12 +200,20 @@ void PceMemoryManager::ExecTemplate()
 	}
 }
 
+template<bool hasCdRom, bool isSuperGrafx>
+void PceMemoryManager::ExecFast()
+{
+	ExecTemplate<hasCdRom, isSuperGrafx>();
+}
+
+template<bool hasCdRom, bool isSuperGrafx>
 void PceMemoryManager::ExecSlow()
 {
-	(this->*_fastExec)();
-	(this->*_fastExec)();
-	(this->*_fastExec)();
-	(this->*_fastExec)();
+	//Call ExecTemplate directly rather than through _fastExec, to allow the 4 calls to be inlined
+	ExecTemplate<hasCdRom, isSuperGrafx>();
+	ExecTemplate<hasCdRom, isSuperGrafx>();
+	ExecTemplate<hasCdRom, isSuperGrafx>();
+	ExecTemplate<hasCdRom, isSuperGrafx>();
 }
 
 uint8_t PceMemoryManager::ReadRegister(uint16_t addr)
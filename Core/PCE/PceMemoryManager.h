@@ -35,6 +35,7 @@ private:
 	Func _fastExec = nullptr;
 
 	PceMemoryManagerState _state = {};
+	uint64_t _timerIrqClock = UINT64_MAX;
 	uint8_t* _prgRom = nullptr;
 	uint32_t _prgRomSize = 0;
 	
@@ -68,9 +69,9 @@ public:
 
 	void UpdateExecCallback();
 	
-	template<bool hasCdRom, bool isSuperGrafx> void ExecTemplate();
-
-	void ExecSlow();
+	template<bool hasCdRom, bool isSuperGrafx> __forceinline void ExecTemplate();
+	template<bool hasCdRom, bool isSuperGrafx> void ExecFast();
+	template<bool hasCdRom, bool isSuperGrafx> void ExecSlow();
 
 	__forceinline void Exec() { (this->*_exec)(); }
 	__forceinline void ExecFastCycle() { (this->*_fastExec)(); }
@@ -95,6 +96,7 @@ public:
 	__forceinline uint8_t GetPendingIrqs() { return (_state.ActiveIrqs & ~_state.DisabledIrqs); }
 	__forceinline bool HasIrqSource(PceIrqSource source) { return (_state.ActiveIrqs & ~_state.DisabledIrqs & (int)source) != 0; }
 	void ClearIrqSource(PceIrqSource source) { _state.ActiveIrqs &= ~(int)source; }
+	void SetTimerIrqClock(uint64_t clock) { _timerIrqClock = clock; }
 
 	void Serialize(Serializer& s);
 };
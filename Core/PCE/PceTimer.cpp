@@ -12,26 +12,66 @@ PceTimer::PceTimer(PceConsole* console)
 	_state.Scaler = 1024 * 3;
 }
 
-void PceTimer::Exec()
+void PceTimer::Run()
 {
-	if(!_state.Enabled) {
-		return;
+	uint64_t clock = _console->GetMemoryManager()->GetState().CycleCount;
+	uint64_t elapsed = clock - _lastClock;
+	_lastClock = clock;
+
+	if(ProcessTicks(_state, elapsed)) {
+		_console->GetMemoryManager()->SetIrqSource(PceIrqSource::TimerIrq);
 	}
 
-	_state.Scaler -= 3;
-	if(_state.Scaler == 0) {
-		_state.Scaler = 1024 * 3;
-		if(_state.Counter == 0) {
-			_state.Counter = _state.ReloadValue;
-			_console->GetMemoryManager()->SetIrqSource(PceIrqSource::TimerIrq);
+	UpdateIrqClock();
+}
+
+bool PceTimer::ProcessTicks(PceTimerState& state, uint64_t elapsed)
+{
+	if(!state.Enabled) {
+		return false;
+	}
+
+	//Process all the ticks that occurred since the last time the timer ran
+	//Run() is called at least once per IRQ, so this only loops up to $80 times
+	bool irq = false;
+	while(elapsed >= state.Scaler) {
+		elapsed -= state.Scaler;
+		state.Scaler = 1024 * 3;
+		if(state.Counter == 0) {
+			state.Counter = state.ReloadValue;
+			irq = true;
 		} else {
-			_state.Counter--;
+			state.Counter--;
 		}
 	}
+	state.Scaler -= (uint16_t)elapsed;
+	return irq;
+}
+
+PceTimerState PceTimer::GetCaughtUpState() const
+{
+	PceTimerState state = _state;
+	uint64_t clock = _console->GetMemoryManager()->GetState().CycleCount;
+	if(clock > _lastClock) {
+		ProcessTicks(state, clock - _lastClock);
+	}
+	return state;
+}
+
+void PceTimer::UpdateIrqClock()
+{
+	uint64_t irqClock = UINT64_MAX;
+	if(_state.Enabled) {
+		//The IRQ occurs on the tick after the counter reaches 0
+		irqClock = _lastClock + _state.Scaler + _state.Counter * 1024 * 3;
+	}
+	_console->GetMemoryManager()->SetTimerIrqClock(irqClock);
 }
 
 void PceTimer::Write(uint16_t addr, uint8_t value)
 {
+	Run();
+
 	if(addr & 0x01) {
 		bool enabled = (value & 0x01) != 0;
 		if(_state.Enabled != enabled) {
@@ -42,10 +82,14 @@ void PceTimer::Write(uint16_t addr, uint8_t value)
 	} else {
 		_state.ReloadValue = value & 0x7F;
 	}
+
+	UpdateIrqClock();
 }
 
 uint8_t PceTimer::Read(uint16_t addr)
 {
+	Run();
+
 	if(_state.Counter == 0 && _state.Scaler <= 5 * 3) {
 		//When the timer is about to expire and rolls back to $7F,
 		//there is a slight delay where the register returns $7F instead
@@ -59,8 +103,18 @@ uint8_t PceTimer::Read(uint16_t addr)
 
 void PceTimer::Serialize(Serializer& s)
 {
+	if(s.IsSaving()) {
+		Run();
+	}
+
 	SV(_state.ReloadValue);
 	SV(_state.Counter);
 	SV(_state.Scaler);
 	SV(_state.Enabled);
+
+	if(!s.IsSaving()) {
+		//The memory manager's state (and cycle count) is loaded before the timer's
+		_lastClock = _console->GetMemoryManager()->GetState().CycleCount;
+		UpdateIrqClock();
+	}
 }
@@ -11,12 +11,21 @@ private:
 	PceTimerState _state = {};
 	PceConsole* _console = nullptr;
 
+	//The timer is only run when its registers are accessed or when its IRQ is due (catch-up execution)
+	uint64_t _lastClock = 0;
+
+	void UpdateIrqClock();
+	static bool ProcessTicks(PceTimerState& state, uint64_t elapsed);
+
 public:
 	PceTimer(PceConsole* console);
 
 	PceTimerState& GetState() { return _state; }
 
-	void Exec();
+	//Returns the timer's state as of the current cycle, without running the timer (safe to call from other threads)
+	PceTimerState GetCaughtUpState() const;
+
+	void Run();
 
 	void Write(uint16_t addr, uint8_t value);
 	uint8_t Read(uint16_t addr);
@@ -303,7 +303,7 @@ void PceVpc::SendFrame(PceVdc* vdc)
 	_console->GetPsg()->Run();
 	_emu->ProcessEndOfFrame();
 
-	_console->GetControlManager()->UpdateInputState();
+	_console->GetControlManager()->RequestInputUpdate();
 	_console->GetControlManager()->UpdateControlDevices();
 }
 
@@ -135,7 +135,9 @@ void SmsDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 			DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, 0, CpuType::Sms);
 			_traceLogger->Log(_cpu->GetState(), disInfo, operation, addressInfo);
 		}
-		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _console->GetMasterClock());
+		if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+			_memoryAccessCounter->ProcessMemoryExec(addressInfo, _console->GetMasterClock());
+		}
 		if(_step->ProcessCpuCycle()) {
 			_debugger->SleepUntilResume(CpuType::Sms, BreakSource::CpuStep, &operation);
 		}
@@ -148,7 +150,9 @@ void SmsDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 			_traceLogger->LogNonExec(operation, addressInfo);
 		}
 
-		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _console->GetMasterClock());
+		if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+			_memoryAccessCounter->ProcessMemoryExec(addressInfo, _console->GetMasterClock());
+		}
 		_step->ProcessCpuCycle();
 		_debugger->ProcessBreakConditions(CpuType::Sms, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 	} else {
@@ -161,15 +165,17 @@ void SmsDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 		}
 
 		if(addr < 0xFE00 || addr >= 0xFF80) {
-			ReadResult result = _memoryAccessCounter->ProcessMemoryRead(addressInfo, _console->GetMasterClock());
-			if(result != ReadResult::Normal) {
-				//Memory access was a read on an uninitialized memory address
-				if(result == ReadResult::FirstUninitRead) {
-					//Only warn the first time
-					_debugger->Log("[SMS] Uninitialized memory read: $" + HexUtilities::ToHex((uint16_t)addr));
-				}
-				if(_settings->CheckDebuggerFlag(DebuggerFlags::SmsDebuggerEnabled) && _settings->GetDebugConfig().BreakOnUninitRead) {
-					_step->Break(BreakSource::BreakOnUninitMemoryRead);
+			if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+				ReadResult result = _memoryAccessCounter->ProcessMemoryRead(addressInfo, _console->GetMasterClock());
+				if(result != ReadResult::Normal) {
+					//Memory access was a read on an uninitialized memory address
+					if(result == ReadResult::FirstUninitRead) {
+						//Only warn the first time
+						_debugger->Log("[SMS] Uninitialized memory read: $" + HexUtilities::ToHex((uint16_t)addr));
+					}
+					if(_settings->CheckDebuggerFlag(DebuggerFlags::SmsDebuggerEnabled) && _settings->GetDebugConfig().BreakOnUninitRead) {
+						_step->Break(BreakSource::BreakOnUninitMemoryRead);
+					}
 				}
 			}
 		}
@@ -193,16 +199,47 @@ void SmsDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType
 		_traceLogger->LogNonExec(operation, addressInfo);
 	}
 
-	_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _console->GetMasterClock());
+	if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+		_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _console->GetMasterClock());
+	}
 	_step->ProcessCpuCycle();
 	_debugger->ProcessBreakConditions(CpuType::Sms, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 }
 
+void SmsDebugger::ProcessCdlRead(uint32_t addr, uint8_t value, MemoryOperationType type)
+{
+	InstructionProgress.LastMemOperation = MemoryOperationInfo(addr, value, type, MemoryType::SmsMemory);
+	if(type == MemoryOperationType::ExecOpCode) {
+		return;
+	}
+
+	AddressInfo addressInfo = _console->GetAbsoluteAddress(addr);
+	if(addressInfo.Address >= 0 && addressInfo.Type == MemoryType::SmsPrgRom) {
+		if(type == MemoryOperationType::ExecOperand) {
+			_codeDataLogger->SetCode(addressInfo.Address);
+		} else {
+			_codeDataLogger->SetData(addressInfo.Address);
+		}
+	}
+}
+
+void SmsDebugger::ProcessCdlWrite(uint32_t addr, uint8_t value, MemoryOperationType type)
+{
+	InstructionProgress.LastMemOperation = MemoryOperationInfo(addr, value, type, MemoryType::SmsMemory);
+
+	AddressInfo addressInfo = _console->GetAbsoluteAddress(addr);
+	if(addressInfo.Type == MemoryType::SmsWorkRam || addressInfo.Type == MemoryType::SmsCartRam) {
+		_disassembler->InvalidateCache(addressInfo, CpuType::Sms);
+	}
+}
+
 template<MemoryOperationType opType>
 void SmsDebugger::ProcessMemoryAccess(uint32_t addr, uint8_t value, MemoryType memType)
 {
-	MemoryOperationInfo operation(addr, value, opType, memType);
-	_eventManager->AddEvent(DebugEventType::Register, operation);
+	if(CheckHookFlag(DebuggerHookFlags::EventViewer)) {
+		MemoryOperationInfo operation(addr, value, opType, memType);
+		_eventManager->AddEvent(DebugEventType::Register, operation);
+	}
 }
 
 void SmsDebugger::Run()
@@ -302,7 +339,9 @@ void SmsDebugger::ProcessPpuRead(uint16_t addr, uint8_t value, MemoryType memory
 	MemoryOperationInfo operation(addr, value, MemoryOperationType::Read, memoryType);
 	AddressInfo addressInfo { addr, memoryType };
 	_debugger->ProcessBreakConditions(CpuType::Sms, *_step.get(), _breakpointManager.get(), operation, addressInfo);
-	_memoryAccessCounter->ProcessMemoryRead(addressInfo, _console->GetMasterClock());
+	if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+		_memoryAccessCounter->ProcessMemoryRead(addressInfo, _console->GetMasterClock());
+	}
 }
 
 void SmsDebugger::ProcessPpuWrite(uint16_t addr, uint8_t value, MemoryType memoryType)
@@ -310,7 +349,9 @@ void SmsDebugger::ProcessPpuWrite(uint16_t addr, uint8_t value, MemoryType memor
 	MemoryOperationInfo operation(addr, value, MemoryOperationType::Write, memoryType);
 	AddressInfo addressInfo { addr, memoryType };
 	_debugger->ProcessBreakConditions(CpuType::Sms, *_step.get(), _breakpointManager.get(), operation, addressInfo);
-	_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _console->GetMasterClock());
+	if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+		_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _console->GetMasterClock());
+	}
 }
 
 void SmsDebugger::ProcessPpuCycle()
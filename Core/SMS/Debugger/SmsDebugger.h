@@ -61,6 +61,8 @@ public:
 	void ProcessInstruction();
 	void ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType type);
 	void ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType type);
+	void ProcessCdlRead(uint32_t addr, uint8_t value, MemoryOperationType type);
+	void ProcessCdlWrite(uint32_t addr, uint8_t value, MemoryOperationType type);
 
 	template<MemoryOperationType opType>
 	void ProcessMemoryAccess(uint32_t addr, uint8_t value, MemoryType memType);
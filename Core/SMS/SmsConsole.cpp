@@ -137,7 +137,7 @@ void SmsConsole::RunFrame()
 void SmsConsole::ProcessEndOfFrame()
 {
 	_controlManager->UpdateControlDevices();
-	_controlManager->UpdateInputState();
+	_controlManager->RequestInputUpdate();
 	_psg->Run();
 }
 
@@ -80,6 +80,8 @@ uint8_t SmsControlManager::InternalReadPort(uint8_t port)
 
 uint8_t SmsControlManager::ReadPort(uint8_t port)
 {
+	ProcessPendingInputUpdate();
+
 	uint8_t value = InternalReadPort(port);
 
 	//Set TR/TH based on the $3F config
@@ -133,6 +135,8 @@ bool SmsControlManager::GetTr(bool portB)
 
 void SmsControlManager::WriteControlPort(uint8_t value)
 {
+	ProcessPendingInputUpdate();
+
 	uint8_t thA = GetTh(false);
 	uint8_t thB = GetTh(true);
 	_state.ControlPort = value;
@@ -30,12 +30,19 @@ void SmsFmAudio::Run()
 {
 	if(_fmEnabled && _emu->GetSettings()->GetSmsConfig().EnableFmAudio) {
 		uint64_t clocksToRun = _console->GetMasterClock() - _prevMasterClock;
-		while(clocksToRun >= 72) {
-			int16_t output = OPLL_calc(_opll);
-			_samplesToPlay.push_back(output);
-			_samplesToPlay.push_back(output);
-			_prevMasterClock += 72;
-			clocksToRun -= 72;
+		uint32_t samplesToRun = (uint32_t)(clocksToRun / 72);
+		_prevMasterClock += (uint64_t)samplesToRun * 72;
+
+		//Register writes call Run() before they are applied, so all samples until now can be generated at once
+		int16_t samples[256];
+		while(samplesToRun > 0) {
+			uint32_t count = std::min<uint32_t>(samplesToRun, 256);
+			OPLL_calcBlock(_opll, samples, count);
+			for(uint32_t i = 0; i < count; i++) {
+				_samplesToPlay.push_back(samples[i]);
+				_samplesToPlay.push_back(samples[i]);
+			}
+			samplesToRun -= count;
 		}
 	} else {
 		_prevMasterClock = _console->GetMasterClock();
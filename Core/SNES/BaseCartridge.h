@@ -138,6 +138,7 @@ public:
 		}
 	}
 
+	bool NeedCoprocessorSync() { return _needCoprocSync; }
 	BaseCoprocessor* GetCoprocessor();
 
 	vector<unique_ptr<IMemoryHandler>>& GetPrgRomHandlers();
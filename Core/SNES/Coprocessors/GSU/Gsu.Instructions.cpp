@@ -93,9 +93,12 @@ void Gsu::BVS()
 	Branch(_state.SFR.Overflow);
 }
 
+template<uint8_t prefixState>
 void Gsu::JMP(uint8_t reg)
 {
-	if(_state.SFR.Alt1) {
+	constexpr bool alt1 = (prefixState & Gsu::PrefixAlt1) != 0;
+
+	if constexpr(alt1) {
 		//LJMP
 		_state.ProgramBank = _state.R[reg] & 0x7F;
 		WriteRegister(15, ReadSrcReg());
@@ -109,9 +112,12 @@ void Gsu::JMP(uint8_t reg)
 	ResetFlags();
 }
 
+template<uint8_t prefixState>
 void Gsu::TO(uint8_t reg)
 {
-	if(_state.SFR.Prefix) {
+	constexpr bool withPrefix = (prefixState & Gsu::PrefixWith) != 0;
+
+	if constexpr(withPrefix) {
 		//MOVE
 		WriteRegister(reg, ReadSrcReg());
 		ResetFlags();
@@ -121,9 +127,12 @@ void Gsu::TO(uint8_t reg)
 	}
 }
 
+template<uint8_t prefixState>
 void Gsu::FROM(uint8_t reg)
 {
-	if(_state.SFR.Prefix) {
+	constexpr bool withPrefix = (prefixState & Gsu::PrefixWith) != 0;
+
+	if constexpr(withPrefix) {
 		//MOVES
 		WriteDestReg(_state.R[reg]);
 		_state.SFR.Overflow = (_state.R[reg] & 0x80) != 0;
@@ -143,21 +152,27 @@ void Gsu::WITH(uint8_t reg)
 	_state.SFR.Prefix = true;
 }
 
+template<uint8_t prefixState>
 void Gsu::STORE(uint8_t reg)
 {
+	constexpr bool alt1 = (prefixState & Gsu::PrefixAlt1) != 0;
+
 	_state.RamAddress = _state.R[reg];
 	WriteRam(_state.RamAddress, (uint8_t)ReadSrcReg());
-	if(!_state.SFR.Alt1) {
+	if constexpr(!alt1) {
 		WriteRam(_state.RamAddress ^ 0x01, ReadSrcReg() >> 8);
 	}
 	ResetFlags();
 }
 
+template<uint8_t prefixState>
 void Gsu::LOAD(uint8_t reg)
 {
+	constexpr bool alt1 = (prefixState & Gsu::PrefixAlt1) != 0;
+
 	_state.RamAddress = _state.R[reg];
 	uint16_t value = ReadRamBuffer(_state.RamAddress);
-	if(!_state.SFR.Alt1) {
+	if constexpr(!alt1) {
 		value |= ReadRamBuffer(_state.RamAddress ^ 0x01) << 8;
 	}
 	WriteDestReg(value);
@@ -217,10 +232,14 @@ void Gsu::SWAP()
 	ResetFlags();
 }
 
+template<uint8_t prefixState>
 void Gsu::Add(uint8_t reg)
 {
+	constexpr bool alt1 = (prefixState & Gsu::PrefixAlt1) != 0;
+	constexpr bool alt2 = (prefixState & Gsu::PrefixAlt2) != 0;
+
 	uint16_t operand;
-	if(_state.SFR.Alt2) {
+	if constexpr(alt2) {
 		//Immediate value
 		operand = reg;
 	} else {
@@ -228,7 +247,7 @@ void Gsu::Add(uint8_t reg)
 	}
 
 	uint32_t result = ReadSrcReg() + operand;
-	if(_state.SFR.Alt1) {
+	if constexpr(alt1) {
 		//ADC - Add with carry
 		result += (uint8_t)_state.SFR.Carry;
 	}
@@ -242,10 +261,14 @@ void Gsu::Add(uint8_t reg)
 	ResetFlags();
 }
 
+template<uint8_t prefixState>
 void Gsu::SubCompare(uint8_t reg)
 {
+	constexpr bool alt1 = (prefixState & Gsu::PrefixAlt1) != 0;
+	constexpr bool alt2 = (prefixState & Gsu::PrefixAlt2) != 0;
+
 	uint16_t operand;
-	if(_state.SFR.Alt2 && !_state.SFR.Alt1) {
+	if constexpr(alt2 && !alt1) {
 		//Immediate value, SUB #val
 		operand = reg;
 	} else {
@@ -253,7 +276,7 @@ void Gsu::SubCompare(uint8_t reg)
 	}
 
 	int32_t result = ReadSrcReg() - operand;
-	if(!_state.SFR.Alt2 && _state.SFR.Alt1) {
+	if constexpr(!alt2 && alt1) {
 		//SBC - SUB with carry
 		result -= _state.SFR.Carry ? 0 : 1;
 	}
@@ -263,17 +286,21 @@ void Gsu::SubCompare(uint8_t reg)
 	_state.SFR.Sign = (result & 0x8000) != 0;
 	_state.SFR.Zero = (result & 0xFFFF) == 0;
 
-	if(!_state.SFR.Alt2 || !_state.SFR.Alt1) {
+	if constexpr(!alt2 || !alt1) {
 		//SUB/SBC, other CMP (and no write occurs for CMP)
 		WriteDestReg(result);
 	}
 	ResetFlags();
 }
 
+template<uint8_t prefixState>
 void Gsu::MULT(uint8_t reg)
 {
+	constexpr bool alt1 = (prefixState & Gsu::PrefixAlt1) != 0;
+	constexpr bool alt2 = (prefixState & Gsu::PrefixAlt2) != 0;
+
 	uint16_t operand;
-	if(_state.SFR.Alt2) {
+	if constexpr(alt2) {
 		//Immediate value
 		operand = reg;
 	} else {
@@ -281,7 +308,7 @@ void Gsu::MULT(uint8_t reg)
 	}
 
 	uint16_t value;
-	if(_state.SFR.Alt1) {
+	if constexpr(alt1) {
 		//UMULT - Unsigned multiply
 		value = (uint16_t)((uint8_t)ReadSrcReg() * (uint8_t)operand);
 	} else {
@@ -298,11 +325,14 @@ void Gsu::MULT(uint8_t reg)
 	Step(_state.HighSpeedMode ? 1 : 2);
 }
 
+template<uint8_t prefixState>
 void Gsu::FMultLMult()
 {
+	constexpr bool alt1 = (prefixState & Gsu::PrefixAlt1) != 0;
+
 	uint32_t multResult = (int16_t)ReadSrcReg() * (int16_t)_state.R[6];
 
-	if(_state.SFR.Alt1) {
+	if constexpr(alt1) {
 		//LMULT - "16x16 signed multiply", LSB in R4, MSB in DREG
 		_state.R[4] = multResult;
 	}
@@ -318,10 +348,14 @@ void Gsu::FMultLMult()
 	Step((_state.HighSpeedMode ? 3 : 7) * (_state.ClockSelect ? 1 : 2));
 }
 
+template<uint8_t prefixState>
 void Gsu::AndBitClear(uint8_t reg)
 {
+	constexpr bool alt1 = (prefixState & Gsu::PrefixAlt1) != 0;
+	constexpr bool alt2 = (prefixState & Gsu::PrefixAlt2) != 0;
+
 	uint16_t operand;
-	if(_state.SFR.Alt2) {
+	if constexpr(alt2) {
 		//Immediate value
 		operand = reg;
 	} else {
@@ -329,7 +363,7 @@ void Gsu::AndBitClear(uint8_t reg)
 	}
 
 	uint16_t value;
-	if(_state.SFR.Alt1) {
+	if constexpr(alt1) {
 		//Bit clear
 		value = ReadSrcReg() & ~operand;
 	} else {
@@ -401,13 +435,16 @@ void Gsu::ROL()
 	ResetFlags();
 }
 
+template<uint8_t prefixState>
 void Gsu::ASR()
 {
+	constexpr bool alt1 = (prefixState & Gsu::PrefixAlt1) != 0;
+
 	uint16_t src = ReadSrcReg();
 	_state.SFR.Carry = (src & 0x01) != 0;
 
 	uint16_t dst = (int16_t)src >> 1;
-	if(_state.SFR.Alt1) {
+	if constexpr(alt1) {
 		dst += (src + 1) >> 16;
 	}
 
@@ -450,16 +487,20 @@ void Gsu::HIB()
 	ResetFlags();
 }
 
+template<uint8_t prefixState>
 void Gsu::IbtSmsLms(uint8_t reg)
 {
-	if(_state.SFR.Alt1) {
+	constexpr bool alt1 = (prefixState & Gsu::PrefixAlt1) != 0;
+	constexpr bool alt2 = (prefixState & Gsu::PrefixAlt2) != 0;
+
+	if constexpr(alt1) {
 		//LMS - "Load word data from RAM, short address"
 		_state.RamAddress = ReadOperand() << 1;
 		uint8_t lsb = ReadRamBuffer(_state.RamAddress);
 		uint8_t msb = ReadRamBuffer(_state.RamAddress | 0x01);
 
 		WriteRegister(reg, (msb << 8) | lsb);
-	} else if(_state.SFR.Alt2) {
+	} else if constexpr(alt2) {
 		//SMS - "Store word data to RAM, short address"
 		_state.RamAddress = ReadOperand() << 1;
 		WriteRam(_state.RamAddress, (uint8_t)_state.R[reg]);
@@ -471,9 +512,13 @@ void Gsu::IbtSmsLms(uint8_t reg)
 	ResetFlags();
 }
 
+template<uint8_t prefixState>
 void Gsu::IwtLmSm(uint8_t reg)
 {
-	if(_state.SFR.Alt1) {
+	constexpr bool alt1 = (prefixState & Gsu::PrefixAlt1) != 0;
+	constexpr bool alt2 = (prefixState & Gsu::PrefixAlt2) != 0;
+
+	if constexpr(alt1) {
 		//LM - Load memory
 		_state.RamAddress = ReadOperand();
 		_state.RamAddress |= ReadOperand() << 8;
@@ -481,7 +526,7 @@ void Gsu::IwtLmSm(uint8_t reg)
 		uint8_t lsb = ReadRamBuffer(_state.RamAddress);
 		uint8_t msb = ReadRamBuffer(_state.RamAddress ^ 0x01);
 		WriteRegister(reg, (msb << 8) | lsb);
-	} else if(_state.SFR.Alt2) {
+	} else if constexpr(alt2) {
 		//SM - Store Memory
 		_state.RamAddress = ReadOperand();
 		_state.RamAddress |= ReadOperand() << 8;
@@ -497,10 +542,14 @@ void Gsu::IwtLmSm(uint8_t reg)
 	ResetFlags();
 }
 
+template<uint8_t prefixState>
 void Gsu::OrXor(uint8_t operand)
 {
+	constexpr bool alt1 = (prefixState & Gsu::PrefixAlt1) != 0;
+	constexpr bool alt2 = (prefixState & Gsu::PrefixAlt2) != 0;
+
 	uint16_t operandValue;
-	if(_state.SFR.Alt2) {
+	if constexpr(alt2) {
 		//Immediate value
 		operandValue = operand;
 	} else {
@@ -509,7 +558,7 @@ void Gsu::OrXor(uint8_t operand)
 	}
 
 	uint16_t value;
-	if(_state.SFR.Alt1) {
+	if constexpr(alt1) {
 		//XOR
 		value = ReadSrcReg() ^ operandValue;
 	} else {
@@ -538,12 +587,16 @@ void Gsu::DEC(uint8_t reg)
 	ResetFlags();
 }
 
+template<uint8_t prefixState>
 void Gsu::GetCRamBRomB()
 {
-	if(!_state.SFR.Alt2) {
+	constexpr bool alt1 = (prefixState & Gsu::PrefixAlt1) != 0;
+	constexpr bool alt2 = (prefixState & Gsu::PrefixAlt2) != 0;
+
+	if constexpr(!alt2) {
 		//GETC - "Get byte from ROM to color register"
 		_state.ColorReg = GetColor(ReadRomBuffer());
-	} else if(!_state.SFR.Alt1) {
+	} else if constexpr(!alt1) {
 		//RAMB - "Set RAM data bank"
 		WaitRamOperation();
 		_state.RamBank = ReadSrcReg() & 0x01;
@@ -555,15 +608,19 @@ void Gsu::GetCRamBRomB()
 	ResetFlags();
 }
 
+template<uint8_t prefixState>
 void Gsu::GETB()
 {
-	if(_state.SFR.Alt2 && _state.SFR.Alt1) {
+	constexpr bool alt1 = (prefixState & Gsu::PrefixAlt1) != 0;
+	constexpr bool alt2 = (prefixState & Gsu::PrefixAlt2) != 0;
+
+	if constexpr(alt2 && alt1) {
 		//GETBS - "Get signed byte from ROM buffer"
 		WriteDestReg((int8_t)ReadRomBuffer());
-	} else if(_state.SFR.Alt2) {
+	} else if constexpr(alt2) {
 		//GETBL - "Get low byte from ROM buffer"
 		WriteDestReg((ReadSrcReg() & 0xFF00) | ReadRomBuffer());
-	} else if(_state.SFR.Alt1) {
+	} else if constexpr(alt1) {
 		//GETBH - "Get high byte from ROM buffer"
 		WriteDestReg((ReadSrcReg() & 0xFF) | (ReadRomBuffer() << 8));
 	} else {
@@ -573,9 +630,12 @@ void Gsu::GETB()
 	ResetFlags();
 }
 
+template<uint8_t prefixState>
 void Gsu::PlotRpix()
 {
-	if(_state.SFR.Alt1) {
+	constexpr bool alt1 = (prefixState & Gsu::PrefixAlt1) != 0;
+
+	if constexpr(alt1) {
 		//RPIX - "Read pixel color"
 		uint8_t value = ReadPixel((uint8_t)_state.R[1], (uint8_t)_state.R[2]);
 		_state.SFR.Zero = (value == 0);
@@ -589,9 +649,12 @@ void Gsu::PlotRpix()
 	ResetFlags();
 }
 
+template<uint8_t prefixState>
 void Gsu::ColorCMode()
 {
-	if(_state.SFR.Alt1) {
+	constexpr bool alt1 = (prefixState & Gsu::PrefixAlt1) != 0;
+
+	if constexpr(alt1) {
 		//CMODE - "Set plot mode"
 		uint8_t value = (uint8_t)ReadSrcReg();
 		_state.PlotTransparent = (value & 0x01) != 0;
@@ -732,4 +795,136 @@ uint8_t Gsu::GetColor(uint8_t value)
 	}
 
 	return value;
-}
\ No newline at end of file
+}
+
+template<uint8_t prefixState>
+Gsu::OpHandler Gsu::GetOpHandler(uint8_t opCode)
+{
+	switch(opCode) {
+		case 0x00: return [](Gsu* gsu, uint8_t) { gsu->STOP(); };
+		case 0x01: return [](Gsu* gsu, uint8_t) { gsu->NOP(); };
+		case 0x02: return [](Gsu* gsu, uint8_t) { gsu->CACHE(); };
+		case 0x03: return [](Gsu* gsu, uint8_t) { gsu->LSR(); };
+		case 0x04: return [](Gsu* gsu, uint8_t) { gsu->ROL(); };
+		case 0x05: return [](Gsu* gsu, uint8_t) { gsu->BRA(); };
+		case 0x06: return [](Gsu* gsu, uint8_t) { gsu->BGE(); };
+		case 0x07: return [](Gsu* gsu, uint8_t) { gsu->BLT(); };
+		case 0x08: return [](Gsu* gsu, uint8_t) { gsu->BNE(); };
+		case 0x09: return [](Gsu* gsu, uint8_t) { gsu->BEQ(); };
+		case 0x0A: return [](Gsu* gsu, uint8_t) { gsu->BPL(); };
+		case 0x0B: return [](Gsu* gsu, uint8_t) { gsu->BMI(); };
+		case 0x0C: return [](Gsu* gsu, uint8_t) { gsu->BCC(); };
+		case 0x0D: return [](Gsu* gsu, uint8_t) { gsu->BCS(); };
+		case 0x0E: return [](Gsu* gsu, uint8_t) { gsu->BVC(); };
+		case 0x0F: return [](Gsu* gsu, uint8_t) { gsu->BVS(); };
+
+		case 0x10: case 0x11: case 0x12: case 0x13: case 0x14: case 0x15: case 0x16: case 0x17:
+		case 0x18: case 0x19: case 0x1A: case 0x1B: case 0x1C: case 0x1D: case 0x1E: case 0x1F:
+			return [](Gsu* gsu, uint8_t reg) { gsu->TO<prefixState>(reg); };
+
+		case 0x20: case 0x21: case 0x22: case 0x23: case 0x24: case 0x25: case 0x26: case 0x27:
+		case 0x28: case 0x29: case 0x2A: case 0x2B: case 0x2C: case 0x2D: case 0x2E: case 0x2F:
+			return [](Gsu* gsu, uint8_t reg) { gsu->WITH(reg); };
+
+		case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+		case 0x38: case 0x39: case 0x3A: case 0x3B:
+			return [](Gsu* gsu, uint8_t reg) { gsu->STORE<prefixState>(reg); };
+
+		case 0x3C: return [](Gsu* gsu, uint8_t) { gsu->LOOP(); };
+		case 0x3D: return [](Gsu* gsu, uint8_t) { gsu->ALT1(); };
+		case 0x3E: return [](Gsu* gsu, uint8_t) { gsu->ALT2(); };
+		case 0x3F: return [](Gsu* gsu, uint8_t) { gsu->ALT3(); };
+
+		case 0x40: case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47:
+		case 0x48: case 0x49: case 0x4A: case 0x4B:
+			return [](Gsu* gsu, uint8_t reg) { gsu->LOAD<prefixState>(reg); };
+
+		case 0x4C: return [](Gsu* gsu, uint8_t) { gsu->PlotRpix<prefixState>(); };
+		case 0x4D: return [](Gsu* gsu, uint8_t) { gsu->SWAP(); };
+		case 0x4E: return [](Gsu* gsu, uint8_t) { gsu->ColorCMode<prefixState>(); };
+		case 0x4F: return [](Gsu* gsu, uint8_t) { gsu->NOT(); };
+
+		case 0x50: case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57:
+		case 0x58: case 0x59: case 0x5A: case 0x5B: case 0x5C: case 0x5D: case 0x5E: case 0x5F:
+			return [](Gsu* gsu, uint8_t reg) { gsu->Add<prefixState>(reg); };
+
+		case 0x60: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+		case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+			return [](Gsu* gsu, uint8_t reg) { gsu->SubCompare<prefixState>(reg); };
+
+		case 0x70: return [](Gsu* gsu, uint8_t) { gsu->MERGE(); };
+
+		case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77:
+		case 0x78: case 0x79: case 0x7A: case 0x7B: case 0x7C: case 0x7D: case 0x7E: case 0x7F:
+			return [](Gsu* gsu, uint8_t reg) { gsu->AndBitClear<prefixState>(reg); };
+
+		case 0x80: case 0x81: case 0x82: case 0x83: case 0x84: case 0x85: case 0x86: case 0x87:
+		case 0x88: case 0x89: case 0x8A: case 0x8B: case 0x8C: case 0x8D: case 0x8E: case 0x8F:
+			return [](Gsu* gsu, uint8_t reg) { gsu->MULT<prefixState>(reg); };
+
+		case 0x90: return [](Gsu* gsu, uint8_t) { gsu->SBK(); };
+
+		case 0x91: case 0x92: case 0x93: case 0x94:
+			return [](Gsu* gsu, uint8_t value) { gsu->LINK(value); };
+
+		case 0x95: return [](Gsu* gsu, uint8_t) { gsu->SignExtend(); };
+
+		case 0x96: return [](Gsu* gsu, uint8_t) { gsu->ASR<prefixState>(); };
+		case 0x97: return [](Gsu* gsu, uint8_t) { gsu->ROR(); };
+
+		case 0x98: case 0x99: case 0x9A: case 0x9B: case 0x9C: case 0x9D:
+			return [](Gsu* gsu, uint8_t reg) { gsu->JMP<prefixState>(reg); };
+
+		case 0x9E: return [](Gsu* gsu, uint8_t) { gsu->LOB(); };
+		case 0x9F: return [](Gsu* gsu, uint8_t) { gsu->FMultLMult<prefixState>(); };
+
+		case 0xA0: case 0xA1: case 0xA2: case 0xA3: case 0xA4: case 0xA5: case 0xA6: case 0xA7:
+		case 0xA8: case 0xA9: case 0xAA: case 0xAB: case 0xAC: case 0xAD: case 0xAE: case 0xAF:
+			return [](Gsu* gsu, uint8_t reg) { gsu->IbtSmsLms<prefixState>(reg); };
+
+		case 0xB0: case 0xB1: case 0xB2: case 0xB3: case 0xB4: case 0xB5: case 0xB6: case 0xB7:
+		case 0xB8: case 0xB9: case 0xBA: case 0xBB: case 0xBC: case 0xBD: case 0xBE: case 0xBF:
+			return [](Gsu* gsu, uint8_t reg) { gsu->FROM<prefixState>(reg); };
+
+		case 0xC0: return [](Gsu* gsu, uint8_t) { gsu->HIB(); };
+
+		case 0xC1: case 0xC2: case 0xC3: case 0xC4: case 0xC5: case 0xC6: case 0xC7:
+		case 0xC8: case 0xC9: case 0xCA: case 0xCB: case 0xCC: case 0xCD: case 0xCE: case 0xCF:
+			return [](Gsu* gsu, uint8_t reg) { gsu->OrXor<prefixState>(reg); };
+
+		case 0xD0: case 0xD1: case 0xD2: case 0xD3: case 0xD4: case 0xD5: case 0xD6: case 0xD7:
+		case 0xD8: case 0xD9: case 0xDA: case 0xDB: case 0xDC: case 0xDD: case 0xDE:
+			return [](Gsu* gsu, uint8_t reg) { gsu->INC(reg); };
+
+		case 0xDF: return [](Gsu* gsu, uint8_t) { gsu->GetCRamBRomB<prefixState>(); };
+
+		case 0xE0: case 0xE1: case 0xE2: case 0xE3: case 0xE4: case 0xE5: case 0xE6: case 0xE7:
+		case 0xE8: case 0xE9: case 0xEA: case 0xEB: case 0xEC: case 0xED: case 0xEE:
+			return [](Gsu* gsu, uint8_t reg) { gsu->DEC(reg); };
+
+		case 0xEF: return [](Gsu* gsu, uint8_t) { gsu->GETB<prefixState>(); };
+
+		default:
+		case 0xF0: case 0xF1: case 0xF2: case 0xF3: case 0xF4: case 0xF5: case 0xF6: case 0xF7:
+		case 0xF8: case 0xF9: case 0xFA: case 0xFB: case 0xFC: case 0xFD: case 0xFE: case 0xFF:
+			return [](Gsu* gsu, uint8_t reg) { gsu->IwtLmSm<prefixState>(reg); };
+	}
+}
+
+std::array<std::array<Gsu::OpHandler, 256>, Gsu::PrefixStateCount> Gsu::BuildOpTable()
+{
+	std::array<std::array<OpHandler, 256>, PrefixStateCount> table = {};
+	for(int i = 0; i < 256; i++) {
+		table[0][i] = GetOpHandler<0>(i);
+		table[1][i] = GetOpHandler<1>(i);
+		table[2][i] = GetOpHandler<2>(i);
+		table[3][i] = GetOpHandler<3>(i);
+		table[4][i] = GetOpHandler<4>(i);
+		table[5][i] = GetOpHandler<5>(i);
+		table[6][i] = GetOpHandler<6>(i);
+		table[7][i] = GetOpHandler<7>(i);
+	}
+	return table;
+}
+
+std::array<std::array<Gsu::OpHandler, 256>, Gsu::PrefixStateCount> Gsu::_opTable = Gsu::BuildOpTable();
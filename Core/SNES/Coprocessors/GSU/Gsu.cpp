@@ -99,135 +99,19 @@ void Gsu::Run()
 	}
 }
 
+uint8_t Gsu::GetPrefixState()
+{
+	return (
+		(_state.SFR.Alt1 ? Gsu::PrefixAlt1 : 0) |
+		(_state.SFR.Alt2 ? Gsu::PrefixAlt2 : 0) |
+		(_state.SFR.Prefix ? Gsu::PrefixWith : 0)
+	);
+}
+
 void Gsu::Exec()
 {
 	uint8_t opCode = ReadOpCode();
-
-	switch(opCode) {
-		case 0x00: STOP(); break;
-		case 0x01: NOP(); break;
-		case 0x02: CACHE(); break;
-		case 0x03: LSR(); break;
-		case 0x04: ROL(); break;
-		case 0x05: BRA(); break;
-		case 0x06: BGE(); break;
-		case 0x07: BLT(); break;
-		case 0x08: BNE(); break;
-		case 0x09: BEQ(); break;
-		case 0x0A: BPL(); break;
-		case 0x0B: BMI(); break;
-		case 0x0C: BCC(); break;
-		case 0x0D: BCS(); break;
-		case 0x0E: BVC(); break;
-		case 0x0F: BVS(); break;
-
-		case 0x10: case 0x11: case 0x12: case 0x13: case 0x14: case 0x15: case 0x16: case 0x17:
-		case 0x18: case 0x19: case 0x1A: case 0x1B: case 0x1C: case 0x1D: case 0x1E: case 0x1F:
-			TO(opCode & 0x0F);
-			break;
-
-		case 0x20: case 0x21: case 0x22: case 0x23: case 0x24: case 0x25: case 0x26: case 0x27:
-		case 0x28: case 0x29: case 0x2A: case 0x2B: case 0x2C: case 0x2D: case 0x2E: case 0x2F:
-			WITH(opCode & 0x0F);
-			break;
-
-		case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
-		case 0x38: case 0x39: case 0x3A: case 0x3B:
-			STORE(opCode & 0x0F);
-			break;
-
-		case 0x3C: LOOP(); break;
-		case 0x3D: ALT1(); break;
-		case 0x3E: ALT2(); break;
-		case 0x3F: ALT3(); break;
-
-		case 0x40: case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47:
-		case 0x48: case 0x49: case 0x4A: case 0x4B:
-			LOAD(opCode & 0x0F);
-			break;
-
-		case 0x4C: PlotRpix(); break;
-		case 0x4D: SWAP(); break;
-		case 0x4E: ColorCMode(); break;
-		case 0x4F: NOT(); break;
-
-		case 0x50: case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57:
-		case 0x58: case 0x59: case 0x5A: case 0x5B: case 0x5C: case 0x5D: case 0x5E: case 0x5F:
-			Add(opCode & 0x0F);
-			break;
-
-		case 0x60: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
-		case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
-			SubCompare(opCode & 0x0F);
-			break;
-
-		case 0x70: MERGE(); break;
-
-		case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77:
-		case 0x78: case 0x79: case 0x7A: case 0x7B: case 0x7C: case 0x7D: case 0x7E: case 0x7F:
-			AndBitClear(opCode & 0x0F);
-			break;
-
-		case 0x80: case 0x81: case 0x82: case 0x83: case 0x84: case 0x85: case 0x86: case 0x87:
-		case 0x88: case 0x89: case 0x8A: case 0x8B: case 0x8C: case 0x8D: case 0x8E: case 0x8F:
-			MULT(opCode & 0x0F);
-			break;
-
-		case 0x90: SBK(); break;
-
-		case 0x91: LINK(1); break;
-		case 0x92: LINK(2); break;
-		case 0x93: LINK(3); break;
-		case 0x94: LINK(4); break;
-
-		case 0x95: SignExtend(); break;
-
-		case 0x96: ASR(); break;
-		case 0x97: ROR(); break;
-
-		case 0x98: case 0x99: case 0x9A: case 0x9B: case 0x9C: case 0x9D:
-			JMP(opCode & 0x0F);
-			break;
-
-		case 0x9E: LOB(); break;
-		case 0x9F: FMultLMult(); break;
-
-		case 0xA0: case 0xA1: case 0xA2: case 0xA3: case 0xA4: case 0xA5: case 0xA6: case 0xA7:
-		case 0xA8: case 0xA9: case 0xAA: case 0xAB: case 0xAC: case 0xAD: case 0xAE: case 0xAF:
-			IbtSmsLms(opCode & 0x0F);
-			break;
-
-		case 0xB0: case 0xB1: case 0xB2: case 0xB3: case 0xB4: case 0xB5: case 0xB6: case 0xB7:
-		case 0xB8: case 0xB9: case 0xBA: case 0xBB: case 0xBC: case 0xBD: case 0xBE: case 0xBF:
-			FROM(opCode & 0x0F);
-			break;
-
-		case 0xC0: HIB(); break;
-
-		case 0xC1: case 0xC2: case 0xC3: case 0xC4: case 0xC5: case 0xC6: case 0xC7:
-		case 0xC8: case 0xC9: case 0xCA: case 0xCB: case 0xCC: case 0xCD: case 0xCE: case 0xCF:
-			OrXor(opCode & 0x0F);
-			break;
-
-		case 0xD0: case 0xD1: case 0xD2: case 0xD3: case 0xD4: case 0xD5: case 0xD6: case 0xD7:
-		case 0xD8: case 0xD9: case 0xDA: case 0xDB: case 0xDC: case 0xDD: case 0xDE:
-			INC(opCode & 0x0F);
-			break;
-
-		case 0xDF: GetCRamBRomB(); break;
-
-		case 0xE0: case 0xE1: case 0xE2: case 0xE3: case 0xE4: case 0xE5: case 0xE6: case 0xE7:
-		case 0xE8: case 0xE9: case 0xEA: case 0xEB: case 0xEC: case 0xED: case 0xEE:
-			DEC(opCode & 0x0F);
-			break;
-
-		case 0xEF: GETB(); break;
-
-		case 0xF0: case 0xF1: case 0xF2: case 0xF3: case 0xF4: case 0xF5: case 0xF6: case 0xF7:
-		case 0xF8: case 0xF9: case 0xFA: case 0xFB: case 0xFC: case 0xFD: case 0xFE: case 0xFF:
-			IwtLmSm(opCode & 0x0F);
-			break;
-	}
+	_opTable[GetPrefixState()][opCode](this, opCode & 0x0F);
 
 	if(_state.SFR.Running) {
 		_emu->ProcessInstruction<CpuType::Gsu>();
@@ -308,11 +192,20 @@ uint8_t Gsu::ReadProgramByte(MemoryOperationType opType)
 {
 	_lastOpAddr = (_state.ProgramBank << 16) | _state.R[15];
 	uint16_t cacheAddr = _state.R[15] - _state.CacheBase;
+	if(cacheAddr < 512 && _cacheValid[cacheAddr >> 4]) {
+		//Most fetches hit the program cache, keep this path small enough to be inlined in ReadOpCode/ReadOperand
+		Step(_state.ClockSelect ? 1 : 2);
+		_emu->ProcessMemoryRead<CpuType::Gsu>(_lastOpAddr, _cache[cacheAddr], opType);
+		return _cache[cacheAddr];
+	}
+	return ReadUncachedProgramByte(cacheAddr, opType);
+}
+
+uint8_t Gsu::ReadUncachedProgramByte(uint16_t cacheAddr, MemoryOperationType opType)
+{
 	if(cacheAddr < 512) {
-		if(!_cacheValid[cacheAddr >> 4]) {
-			InitProgramCache(cacheAddr & 0xFFF0);
-		}
-		
+		InitProgramCache(cacheAddr & 0xFFF0);
+
 		Step(_state.ClockSelect ? 1 : 2);
 		_emu->ProcessMemoryRead<CpuType::Gsu>(_lastOpAddr, _cache[cacheAddr], opType);
 		return _cache[cacheAddr];
@@ -425,10 +318,8 @@ void Gsu::WriteRam(uint16_t addr, uint8_t value)
 	_state.RamWriteValue = value;
 }
 
-void Gsu::Step(uint64_t cycles)
+void Gsu::ProcessPendingAccesses(uint64_t cycles)
 {
-	_state.CycleCount += cycles;
-
 	if(_state.RomDelay) {
 		_state.RomDelay -= std::min<uint8_t>((uint8_t)cycles, _state.RomDelay);
 		if(_state.RomDelay == 0) {
@@ -1,5 +1,6 @@
 #pragma once
 #include "pch.h"
+#include <array>
 #include "SNES/Coprocessors/BaseCoprocessor.h"
 #include "SNES/Coprocessors/GSU/GsuTypes.h"
 #include "SNES/MemoryMappings.h"
@@ -16,6 +17,17 @@ enum class MemoryOperationType;
 class Gsu : public BaseCoprocessor
 {
 private:
+	//Prefix state (set by the ALT1/ALT2/ALT3 and WITH instructions) used to resolve instructions
+	static constexpr uint8_t PrefixAlt1 = 0x01;
+	static constexpr uint8_t PrefixAlt2 = 0x02;
+	static constexpr uint8_t PrefixWith = 0x04;
+	static constexpr uint8_t PrefixStateCount = 8;
+
+	typedef void(*OpHandler)(Gsu* gsu, uint8_t operand);
+
+	//Instruction handlers for every opcode and prefix state
+	static std::array<std::array<OpHandler, 256>, PrefixStateCount> _opTable;
+
 	Emulator* _emu;
 	SnesConsole *_console;
 	SnesMemoryManager *_memoryManager;
@@ -43,11 +55,16 @@ private:
 
 	void Exec();
 
+	uint8_t GetPrefixState();
+	template<uint8_t prefixState> static OpHandler GetOpHandler(uint8_t opCode);
+	static std::array<std::array<OpHandler, 256>, PrefixStateCount> BuildOpTable();
+
 	void InitProgramCache(uint16_t cacheAddr);
 
 	uint8_t ReadOperand();	
 	uint8_t ReadOpCode();
-	uint8_t ReadProgramByte(MemoryOperationType opType);
+	__forceinline uint8_t ReadProgramByte(MemoryOperationType opType);
+	uint8_t ReadUncachedProgramByte(uint16_t cacheAddr, MemoryOperationType opType);
 
 	uint16_t ReadSrcReg();
 	void WriteDestReg(uint16_t value);
@@ -66,7 +83,15 @@ private:
 	uint8_t ReadRomBuffer();
 	uint8_t ReadRamBuffer(uint16_t addr);
 	void WriteRam(uint16_t addr, uint8_t value);
-	void Step(uint64_t cycles);
+	void ProcessPendingAccesses(uint64_t cycles);
+
+	__forceinline void Step(uint64_t cycles)
+	{
+		_state.CycleCount += cycles;
+		if(_state.RomDelay | _state.RamDelay) {
+			ProcessPendingAccesses(cycles);
+		}
+	}
 
 	void STOP();
 	void NOP();
@@ -85,14 +110,14 @@ private:
 	void BCS();
 	void BVC();
 	void BVS();
-	void JMP(uint8_t reg);
+	template<uint8_t prefixState> void JMP(uint8_t reg);
 
-	void TO(uint8_t reg);
-	void FROM(uint8_t reg);
+	template<uint8_t prefixState> void TO(uint8_t reg);
+	template<uint8_t prefixState> void FROM(uint8_t reg);
 	void WITH(uint8_t reg);
 
-	void STORE(uint8_t reg);
-	void LOAD(uint8_t reg);
+	template<uint8_t prefixState> void STORE(uint8_t reg);
+	template<uint8_t prefixState> void LOAD(uint8_t reg);
 
 	void LOOP();
 	void ALT1();
@@ -102,8 +127,8 @@ private:
 	void MERGE();
 	void SWAP();
 
-	void PlotRpix();
-	void ColorCMode();
+	template<uint8_t prefixState> void PlotRpix();
+	template<uint8_t prefixState> void ColorCMode();
 
 	uint16_t GetTileIndex(uint8_t x, uint8_t y);
 	uint32_t GetTileAddress(uint8_t x, uint8_t y);
@@ -116,12 +141,12 @@ private:
 
 	uint8_t GetColor(uint8_t source);
 
-	void Add(uint8_t reg);
-	void SubCompare(uint8_t reg);
-	void MULT(uint8_t reg);
-	void FMultLMult();
+	template<uint8_t prefixState> void Add(uint8_t reg);
+	template<uint8_t prefixState> void SubCompare(uint8_t reg);
+	template<uint8_t prefixState> void MULT(uint8_t reg);
+	template<uint8_t prefixState> void FMultLMult();
 
-	void AndBitClear(uint8_t reg);
+	template<uint8_t prefixState> void AndBitClear(uint8_t reg);
 	void SBK();
 
 	void LINK(uint8_t reg);
@@ -131,21 +156,21 @@ private:
 	void NOT();
 	void LSR();
 	void ROL();
-	void ASR();
+	template<uint8_t prefixState> void ASR();
 	void ROR();
 
 	void LOB();
 	void HIB();
 
-	void IbtSmsLms(uint8_t reg);
-	void IwtLmSm(uint8_t reg);
+	template<uint8_t prefixState> void IbtSmsLms(uint8_t reg);
+	template<uint8_t prefixState> void IwtLmSm(uint8_t reg);
 
-	void OrXor(uint8_t reg);
+	template<uint8_t prefixState> void OrXor(uint8_t reg);
 	void INC(uint8_t reg);
 	void DEC(uint8_t reg);
 
-	void GetCRamBRomB();
-	void GETB();
+	template<uint8_t prefixState> void GetCRamBRomB();
+	template<uint8_t prefixState> void GETB();
 
 public:
 	Gsu(SnesConsole *console, uint32_t gsuRamSize);
@@ -27,6 +27,11 @@ SuperGameboy::SuperGameboy(SnesConsole* console, Gameboy* gameboy)
 	_controlManager = (GbControlManager*)gameboy->GetControlManager();
 	_ppu = gameboy->GetPpu();
 
+	_stopThread = false;
+	_threadTargetCycle = 0;
+	_inputWriteHead = 0;
+	_inputWriteTail = 0;
+
 	_control = 0x01; //Divider = 5, gameboy = not running
 	UpdateClockRatio();
 	
@@ -41,11 +46,103 @@ SuperGameboy::SuperGameboy(SnesConsole* console, Gameboy* gameboy)
 
 SuperGameboy::~SuperGameboy()
 {
+	StopThread();
 	_emu->GetSoundMixer()->UnregisterAudioProvider(this);
 }
 
+void SuperGameboy::StopThread()
+{
+	if(_thread.joinable()) {
+		_stopThread = true;
+		_threadSignal.Signal();
+		_thread.join();
+	}
+}
+
+void SuperGameboy::ThreadLoop()
+{
+	while(!_stopThread) {
+		_threadSignal.Wait();
+		if(_stopThread) {
+			break;
+		}
+
+		auto lock = _runLock.AcquireSafe();
+		ProcessPendingWork();
+	}
+}
+
+void SuperGameboy::UpdateThreadState()
+{
+	//Called at the start of each frame - the Game Boy's debugger hooks must run on the emulation
+	//thread, so the Game Boy is always run inline while the debugger is active
+	bool useThread = _emu->GetSettings()->GetGameboyConfig().RunSgbOnSeparateThread && !_emu->IsDebugging();
+	if(useThread != _useThread) {
+		auto lock = _runLock.AcquireSafe();
+		CatchUp();
+		ClearThreadTarget();
+		if(useThread && !_thread.joinable()) {
+			_stopThread = false;
+			_thread = std::thread(&SuperGameboy::ThreadLoop, this);
+		}
+		_useThread = useThread;
+	}
+}
+
+void SuperGameboy::ProcessPendingWork()
+{
+	//Must be called while holding _runLock
+	//Load the target before the queue's head - any write queued before this target was set will be processed
+	uint64_t targetCycle = _threadTargetCycle.load(std::memory_order_acquire);
+	uint32_t head = _inputWriteHead.load(std::memory_order_acquire);
+	uint32_t tail = _inputWriteTail.load(std::memory_order_relaxed);
+	bool running = (_control & 0x80) != 0;
+
+	while(tail != head) {
+		InputWrite& write = _inputWrites[tail & (InputWriteQueueSize - 1)];
+		if(running) {
+			_gameboy->Run(write.Cycle);
+		}
+		SetInputValue(write.Index, write.Value);
+		tail++;
+		_inputWriteTail.store(tail, std::memory_order_release);
+	}
+
+	if(running) {
+		_gameboy->Run(targetCycle);
+	}
+}
+
+void SuperGameboy::CatchUp()
+{
+	//Must be called while holding _runLock - runs the Game Boy up to the SNES CPU's position (as of the last Run call)
+	if(_useThread) {
+		_threadTargetCycle.store(_syncTargetCycle, std::memory_order_release);
+		ProcessPendingWork();
+	}
+}
+
+void SuperGameboy::Synchronize()
+{
+	auto lock = _runLock.AcquireSafe();
+	CatchUp();
+}
+
+void SuperGameboy::ClearThreadTarget()
+{
+	//Called (while holding _runLock) when the Game Boy's cycle counter or the clock ratio are reset,
+	//otherwise the thread could run up to a target that was calculated based on the old values
+	_threadTargetCycle = 0;
+	_lastSignaledCycle = 0;
+	_syncTargetCycle = 0;
+}
+
 void SuperGameboy::Reset()
 {
+	auto lock = _runLock.AcquireSafe();
+	CatchUp();
+	ClearThreadTarget();
+
 	_control = 0;
 	_resetClock = 0;
 
@@ -55,7 +152,6 @@ void SuperGameboy::Reset()
 	_listeningForPacket = false;
 	_waitForHigh = true;
 	_packetReady = false;
-	_inputWriteClock = 0;
 	_inputValue = 0;
 	memset(_packetData, 0, sizeof(_packetData));
 	_packetByte = 0;
@@ -68,6 +164,10 @@ void SuperGameboy::Reset()
 
 uint8_t SuperGameboy::Read(uint32_t addr)
 {
+	//The packet, LCD buffer and the Game Boy's current scanline are all updated by the Game Boy
+	auto lock = _runLock.AcquireSafe();
+	CatchUp();
+
 	addr &= 0xF80F;
 	
 	if(addr >= 0x7000 && addr <= 0x700F) {
@@ -113,10 +213,15 @@ void SuperGameboy::Write(uint32_t addr, uint8_t value)
 			break;
 
 		case 0x6003: {
+			//Can power on the Game Boy or change its clock rate, the Game Boy needs to be caught up first
+			auto lock = _runLock.AcquireSafe();
+			CatchUp();
+
 			if(!(_control & 0x80) && (value & 0x80)) {
 				_clockOffset = 0;
 				_resetClock = _memoryManager->GetMasterClock();
 				_gameboy->PowerOn(this);
+				ClearThreadTarget();
 			}
 			_control = value;
 			SetInputIndex(_inputIndex % GetPlayerCount());
@@ -125,10 +230,10 @@ void SuperGameboy::Write(uint32_t addr, uint8_t value)
 			break;
 		}
 
-		case 0x6004: SetInputValue(0, value); break;
-		case 0x6005: SetInputValue(1, value); break;
-		case 0x6006: SetInputValue(2, value); break;
-		case 0x6007: SetInputValue(3, value); break;
+		case 0x6004: WriteInputValue(0, value); break;
+		case 0x6005: WriteInputValue(1, value); break;
+		case 0x6006: WriteInputValue(2, value); break;
+		case 0x6007: WriteInputValue(3, value); break;
 	}
 }
 
@@ -190,7 +295,6 @@ void SuperGameboy::ProcessInputPortWrite(uint8_t value)
 	}
 
 	_inputValue = value;
-	_inputWriteClock = _memoryManager->GetMasterClock();
 }
 
 void SuperGameboy::LogPacket()
@@ -269,6 +373,9 @@ uint8_t SuperGameboy::GetPlayerCount()
 
 void SuperGameboy::MixAudio(int16_t* out, uint32_t sampleCount, uint32_t sampleRate)
 {
+	auto lock = _runLock.AcquireSafe();
+	CatchUp();
+
 	int16_t* gbSamples = nullptr;
 	uint32_t gbSampleCount = 0;
 	_gameboy->GetSoundSamples(gbSamples, gbSampleCount);
@@ -279,13 +386,29 @@ void SuperGameboy::MixAudio(int16_t* out, uint32_t sampleCount, uint32_t sampleR
 	}
 }
 
+uint64_t SuperGameboy::GetTargetCycle()
+{
+	return _clockOffset + (uint64_t)((_memoryManager->GetMasterClock() - _resetClock) * _clockRatio);
+}
+
 void SuperGameboy::Run()
 {
 	if(!(_control & 0x80)) {
 		return;
 	}
 
-	_gameboy->Run(_clockOffset + (uint64_t)((_memoryManager->GetMasterClock() - _resetClock) * _clockRatio));
+	uint64_t targetCycle = GetTargetCycle();
+	if(_useThread) {
+		//Let the Game Boy thread run up to the current cycle in the background
+		_syncTargetCycle = targetCycle;
+		if(targetCycle >= _lastSignaledCycle + ThreadRunInterval) {
+			_lastSignaledCycle = targetCycle;
+			_threadTargetCycle.store(targetCycle, std::memory_order_release);
+			_threadSignal.Signal();
+		}
+	} else {
+		_gameboy->Run(targetCycle);
+	}
 }
 
 void SuperGameboy::UpdateClockRatio()
@@ -306,7 +429,9 @@ void SuperGameboy::UpdateClockRatio()
 		_effectiveClockRate = effectiveRate;
 
 		double clockRatio = _effectiveClockRate / _console->GetMasterClockRate();
+		auto lock = _runLock.AcquireSafe();
 		Run();
+		CatchUp();
 		_clockOffset = _gameboy->GetCycleCount();
 		_resetClock = _memoryManager->GetMasterClock();
 		_clockRatio = clockRatio;
@@ -333,6 +458,23 @@ void SuperGameboy::SetInputIndex(uint8_t index)
 	_controlManager->ProcessInputChange([=]() { _inputIndex = index; });
 }
 
+void SuperGameboy::WriteInputValue(uint8_t index, uint8_t value)
+{
+	if(_useThread) {
+		//Queue the write, the Game Boy thread will apply it when it reaches this cycle
+		uint32_t head = _inputWriteHead.load(std::memory_order_relaxed);
+		if(head - _inputWriteTail.load(std::memory_order_acquire) >= InputWriteQueueSize) {
+			//Queue is full, wait for the Game Boy to catch up
+			Synchronize();
+		}
+		_inputWrites[head & (InputWriteQueueSize - 1)] = { _syncTargetCycle, index, value };
+		_inputWriteHead.store(head + 1, std::memory_order_release);
+		return;
+	}
+
+	SetInputValue(index, value);
+}
+
 void SuperGameboy::SetInputValue(uint8_t index, uint8_t value)
 {
 	if(_inputIndex == index) {
@@ -359,8 +501,17 @@ AddressInfo SuperGameboy::GetAbsoluteAddress(uint32_t address)
 
 void SuperGameboy::Serialize(Serializer& s)
 {
+	auto lock = _runLock.AcquireSafe();
+	if(s.GetFormat() != SerializeFormat::Map) {
+		//Catch up the Game Boy before its state is saved (or overwritten)
+		CatchUp();
+		if(!s.IsSaving()) {
+			ClearThreadTarget();
+		}
+	}
+
 	SV(_control); SV(_resetClock); SV(_input[0]); SV(_input[1]); SV(_input[2]); SV(_input[3]); SV(_inputIndex); SV(_listeningForPacket); SV(_packetReady);
-	SV(_inputWriteClock); SV(_inputValue); SV(_packetByte); SV(_packetBit); SV(_lcdRowSelect); SV(_readPosition); SV(_waitForHigh); SV(_clockRatio);
+	SV(_inputValue); SV(_packetByte); SV(_packetBit); SV(_lcdRowSelect); SV(_readPosition); SV(_waitForHigh); SV(_clockRatio);
 
 	SVArray(_packetData, 16);
 	SVArray(_lcdBuffer[0], 1280);
@@ -3,6 +3,9 @@
 #include "SNES/Coprocessors/BaseCoprocessor.h"
 #include "Shared/Interfaces/IAudioProvider.h"
 #include "Utilities/Audio/HermiteResampler.h"
+#include "Utilities/SimpleLock.h"
+#include "Utilities/AutoResetEvent.h"
+#include <thread>
 
 class SnesConsole;
 class Emulator;
@@ -16,6 +19,11 @@ class GbPpu;
 class SuperGameboy : public BaseCoprocessor, public IAudioProvider
 {
 private:
+	//Max number of input writes ($6004-$6007) that can be queued for the Game Boy thread
+	static constexpr uint32_t InputWriteQueueSize = 0x100;
+	//Minimum amount of Game Boy cycles to accumulate before waking up the Game Boy thread
+	static constexpr uint64_t ThreadRunInterval = 4096;
+
 	SnesConsole* _console = nullptr;
 	Emulator* _emu = nullptr;
 	SnesMemoryManager* _memoryManager = nullptr;
@@ -37,7 +45,6 @@ private:
 	bool _listeningForPacket = false;
 	bool _waitForHigh = true;
 	bool _packetReady = false;
-	uint64_t _inputWriteClock = 0;
 	uint8_t _inputValue = 0;	
 	uint8_t _packetData[16] = {};
 	uint8_t _packetByte = 0;
@@ -49,12 +56,46 @@ private:
 	
 	HermiteResampler _resampler;
 
+	//When running on its own thread, the Game Boy only has to be in sync with the SNES CPU when the CPU
+	//reads the SGB's registers, changes its control register, or when the audio is mixed (and at the end
+	//of each frame). Input writes are queued with the Game Boy cycle at which they occurred and applied
+	//at that exact cycle, so the results are identical to running both cores on the emulation thread.
+	//All Game Boy execution is done while holding _runLock (by either thread).
+	struct InputWrite
+	{
+		uint64_t Cycle;
+		uint8_t Index;
+		uint8_t Value;
+	};
+
+	bool _useThread = false;
+	std::thread _thread;
+	atomic<bool> _stopThread;
+	AutoResetEvent _threadSignal;
+	SimpleLock _runLock;
+	atomic<uint64_t> _threadTargetCycle;
+	uint64_t _lastSignaledCycle = 0;
+	//Game Boy cycle the last Run() call caught up to (the SNES CPU's current position)
+	uint64_t _syncTargetCycle = 0;
+
+	InputWrite _inputWrites[InputWriteQueueSize] = {};
+	atomic<uint32_t> _inputWriteHead;
+	atomic<uint32_t> _inputWriteTail;
+
 	uint8_t GetLcdRow();
 	uint8_t GetLcdBufferRow();
 	uint8_t GetPlayerCount();
 
 	void SetInputIndex(uint8_t index);
 	void SetInputValue(uint8_t index, uint8_t value);
+	void WriteInputValue(uint8_t index, uint8_t value);
+
+	uint64_t GetTargetCycle();
+	void ProcessPendingWork();
+	void CatchUp();
+	void ClearThreadTarget();
+	void ThreadLoop();
+	void StopThread();
 
 public:
 	SuperGameboy(SnesConsole* console, Gameboy* gameboy);
@@ -67,6 +108,9 @@ public:
 
 	void Run() override;
 
+	void Synchronize();
+	void UpdateThreadState();
+
 	void ProcessInputPortWrite(uint8_t value);
 
 	void LogPacket();
@@ -64,7 +64,9 @@ void GsuDebugger::ProcessInstruction()
 
 	_step->ProcessCpuExec();
 
-	_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetMasterClock());
+	if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetMasterClock());
+	}
 	_debugger->ProcessBreakConditions(CpuType::Gsu, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 }
 
@@ -79,12 +81,16 @@ void GsuDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 			DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, 0, CpuType::Gsu);
 			_traceLogger->Log(_gsu->GetState(), disInfo, operation, addressInfo);
 		}
-		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetMasterClock());
+		if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+			_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetMasterClock());
+		}
 	} else if(type == MemoryOperationType::ExecOperand) {
 		if(addressInfo.Type == MemoryType::SnesPrgRom) {
 			_codeDataLogger->SetData<SnesCdlFlags::Gsu>(addressInfo.Address);
 		}
-		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetMasterClock());
+		if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+			_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetMasterClock());
+		}
 	} else {
 		if(addressInfo.Type == MemoryType::SnesPrgRom) {
 			_codeDataLogger->SetData<SnesCdlFlags::Gsu>(addressInfo.Address);
@@ -92,7 +98,9 @@ void GsuDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 		if(_traceLogger->IsEnabled()) {
 			_traceLogger->LogNonExec(operation, addressInfo);
 		}
-		_memoryAccessCounter->ProcessMemoryRead(addressInfo, _memoryManager->GetMasterClock());
+		if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+			_memoryAccessCounter->ProcessMemoryRead(addressInfo, _memoryManager->GetMasterClock());
+		}
 		_debugger->ProcessBreakConditions(CpuType::Gsu, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 	}
 }
@@ -110,7 +118,30 @@ void GsuDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType
 	}
 
 	_disassembler->InvalidateCache(addressInfo, CpuType::Gsu);
-	_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _memoryManager->GetMasterClock());
+	if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+		_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _memoryManager->GetMasterClock());
+	}
+}
+
+void GsuDebugger::ProcessCdlRead(uint32_t addr, uint8_t value, MemoryOperationType type)
+{
+	InstructionProgress.LastMemOperation = MemoryOperationInfo(addr, value, type, MemoryType::GsuMemory);
+	if(type == MemoryOperationType::ExecOpCode) {
+		return;
+	}
+
+	AddressInfo addressInfo = _gsu->GetMemoryMappings()->GetAbsoluteAddress(addr);
+	if(addressInfo.Type == MemoryType::SnesPrgRom) {
+		_codeDataLogger->SetData<SnesCdlFlags::Gsu>(addressInfo.Address);
+	}
+}
+
+void GsuDebugger::ProcessCdlWrite(uint32_t addr, uint8_t value, MemoryOperationType type)
+{
+	InstructionProgress.LastMemOperation = MemoryOperationInfo(addr, value, type, MemoryType::GsuMemory);
+
+	AddressInfo addressInfo = _gsu->GetMemoryMappings()->GetAbsoluteAddress(addr);
+	_disassembler->InvalidateCache(addressInfo, CpuType::Gsu);
 }
 
 void GsuDebugger::Run()
@@ -39,6 +39,8 @@ public:
 	void ProcessInstruction();
 	void ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType type);
 	void ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType type);
+	void ProcessCdlRead(uint32_t addr, uint8_t value, MemoryOperationType type);
+	void ProcessCdlWrite(uint32_t addr, uint8_t value, MemoryOperationType type);
 
 	void Run() override;
 	void Step(int32_t stepCount, StepType type) override;
@@ -195,17 +195,20 @@ void SnesDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 	InstructionProgress.LastMemOperation = operation;
 	SnesCpuState& state = GetCpuState();
 
-	if(IsRegister(addr)) {
+	if(CheckHookFlag(DebuggerHookFlags::EventViewer) && IsRegister(addr)) {
 		_eventManager->AddEvent(DebugEventType::Register, operation);
 	}
 
+	bool accessCounters = CheckHookFlag(DebuggerHookFlags::AccessCounters);
 	if(type == MemoryOperationType::ExecOpCode) {
 		if(_traceLogger->IsEnabled()) {
 			DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, state.PS, _cpuType);
 			_traceLogger->Log(state, disInfo, operation, addressInfo);
 		}
 		
-		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetMasterClock());
+		if(accessCounters) {
+			_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetMasterClock());
+		}
 		if(_step->ProcessCpuCycle()) {
 			_debugger->SleepUntilResume(_cpuType, BreakSource::CpuStep, &operation);
 		}
@@ -217,7 +220,9 @@ void SnesDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 			_traceLogger->LogNonExec(operation, addressInfo);
 		}
 
-		_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetMasterClock());
+		if(accessCounters) {
+			_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetMasterClock());
+		}
 		_step->ProcessCpuCycle();
 		_debugger->ProcessBreakConditions(_cpuType, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 	} else {
@@ -228,15 +233,17 @@ void SnesDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 			_traceLogger->LogNonExec(operation, addressInfo);
 		}
 
-		ReadResult result = _memoryAccessCounter->ProcessMemoryRead(addressInfo, _memoryManager->GetMasterClock());
-		if(result != ReadResult::Normal) {
-			//Memory access was a read on an uninitialized memory address
-			if(result == ReadResult::FirstUninitRead) {
-				//Only warn the first time
-				_debugger->Log(string(_cpuType == CpuType::Sa1 ? "[SA1]" : "[CPU]") + " Uninitialized memory read: $" + HexUtilities::ToHex24(addr));
-			}
-			if(_debuggerEnabled && _settings->GetDebugConfig().BreakOnUninitRead) {
-				_step->Break(BreakSource::BreakOnUninitMemoryRead);
+		if(accessCounters) {
+			ReadResult result = _memoryAccessCounter->ProcessMemoryRead(addressInfo, _memoryManager->GetMasterClock());
+			if(result != ReadResult::Normal) {
+				//Memory access was a read on an uninitialized memory address
+				if(result == ReadResult::FirstUninitRead) {
+					//Only warn the first time
+					_debugger->Log(string(_cpuType == CpuType::Sa1 ? "[SA1]" : "[CPU]") + " Uninitialized memory read: $" + HexUtilities::ToHex24(addr));
+				}
+				if(_debuggerEnabled && _settings->GetDebugConfig().BreakOnUninitRead) {
+					_step->Break(BreakSource::BreakOnUninitMemoryRead);
+				}
 			}
 		}
 		
@@ -256,7 +263,7 @@ void SnesDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationTyp
 		_disassembler->InvalidateCache(addressInfo, _cpuType);
 	}
 
-	if(IsRegister(addr)) {
+	if(CheckHookFlag(DebuggerHookFlags::EventViewer) && IsRegister(addr)) {
 		_eventManager->AddEvent(DebugEventType::Register, operation);
 	}
 
@@ -264,7 +271,9 @@ void SnesDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationTyp
 		_traceLogger->LogNonExec(operation, addressInfo);
 	}
 
-	_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _memoryManager->GetMasterClock());
+	if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+		_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _memoryManager->GetMasterClock());
+	}
 
 	if(type != MemoryOperationType::DmaWrite) {
 		_step->ProcessCpuCycle();
@@ -272,6 +281,37 @@ void SnesDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationTyp
 	_debugger->ProcessBreakConditions(_cpuType, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 }
 
+void SnesDebugger::ProcessCdlRead(uint32_t addr, uint8_t value, MemoryOperationType type)
+{
+	InstructionProgress.LastMemOperation = MemoryOperationInfo(addr, value, type, _cpuMemType);
+	if(type == MemoryOperationType::ExecOpCode || IsRegister(addr)) {
+		//Opcodes are logged by ProcessInstruction, registers are never in PRG ROM
+		return;
+	}
+
+	AddressInfo addressInfo = _memoryMappings->GetAbsoluteAddress(addr);
+	if(addressInfo.Type == MemoryType::SnesPrgRom && addressInfo.Address >= 0) {
+		if(type == MemoryOperationType::ExecOperand) {
+			_cdl->SetCode(addressInfo.Address, (GetCpuState().PS & (SnesCdlFlags::IndexMode8 | SnesCdlFlags::MemoryMode8)));
+		} else {
+			_cdl->SetData(addressInfo.Address);
+		}
+	}
+}
+
+void SnesDebugger::ProcessCdlWrite(uint32_t addr, uint8_t value, MemoryOperationType type)
+{
+	InstructionProgress.LastMemOperation = MemoryOperationInfo(addr, value, type, _cpuMemType);
+	if(IsRegister(addr)) {
+		return;
+	}
+
+	AddressInfo addressInfo = _memoryMappings->GetAbsoluteAddress(addr);
+	if(addressInfo.Address >= 0 && (addressInfo.Type == MemoryType::SnesWorkRam || addressInfo.Type == MemoryType::SnesSaveRam)) {
+		_disassembler->InvalidateCache(addressInfo, _cpuType);
+	}
+}
+
 void SnesDebugger::ProcessIdleCycle()
 {
 	if(_step->ProcessCpuCycle()) {
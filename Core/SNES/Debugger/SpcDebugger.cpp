@@ -124,15 +124,21 @@ void SpcDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 				DisassemblyInfo disInfo = _disassembler->GetDisassemblyInfo(addressInfo, addr, 0, CpuType::Spc);
 				_traceLogger->Log(state, disInfo, operation, addressInfo);
 			}
-			_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetMasterClock());
+			if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+				_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetMasterClock());
+			}
 		} else if(type == MemoryOperationType::ExecOperand) {
-			_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetMasterClock());
+			if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+				_memoryAccessCounter->ProcessMemoryExec(addressInfo, _memoryManager->GetMasterClock());
+			}
 			if(_traceLogger->IsEnabled()) {
 				_traceLogger->LogNonExec(operation, addressInfo);
 			}
 			_debugger->ProcessBreakConditions(CpuType::Spc, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 		} else {
-			_memoryAccessCounter->ProcessMemoryRead(addressInfo, _memoryManager->GetMasterClock());
+			if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+				_memoryAccessCounter->ProcessMemoryRead(addressInfo, _memoryManager->GetMasterClock());
+			}
 			if(_traceLogger->IsEnabled()) {
 				_traceLogger->LogNonExec(operation, addressInfo);
 			}
@@ -143,7 +149,9 @@ void SpcDebugger::ProcessRead(uint32_t addr, uint8_t value, MemoryOperationType
 		if(!_ignoreDspReadWrites) {
 			AddressInfo addressInfo { (int32_t)addr, MemoryType::SpcRam }; //DSP reads never read from the IPL ROM
 
-			_memoryAccessCounter->ProcessMemoryRead(addressInfo, _memoryManager->GetMasterClock());
+			if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+				_memoryAccessCounter->ProcessMemoryRead(addressInfo, _memoryManager->GetMasterClock());
+			}
 			_debugger->ProcessBreakConditions(CpuType::Spc, *_step.get(), _breakpointManager.get(), operation, addressInfo);
 		}
 	}
@@ -162,7 +170,9 @@ void SpcDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType
 	if constexpr(flags == MemoryAccessFlags::None) {
 		//SPC write
 		_debugger->ProcessBreakConditions(CpuType::Spc, *_step.get(), _breakpointManager.get(), operation, addressInfo);
-		_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _memoryManager->GetMasterClock());
+		if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+			_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _memoryManager->GetMasterClock());
+		}
 
 		if(_traceLogger->IsEnabled()) {
 			_traceLogger->LogNonExec(operation, addressInfo);
@@ -171,11 +181,27 @@ void SpcDebugger::ProcessWrite(uint32_t addr, uint8_t value, MemoryOperationType
 		//DSP write
 		if(!_ignoreDspReadWrites) {
 			_debugger->ProcessBreakConditions(CpuType::Spc, *_step.get(), _breakpointManager.get(), operation, addressInfo);
-			_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _memoryManager->GetMasterClock());
+			if(CheckHookFlag(DebuggerHookFlags::AccessCounters)) {
+				_memoryAccessCounter->ProcessMemoryWrite(addressInfo, _memoryManager->GetMasterClock());
+			}
 		}
 	}
 }
 
+void SpcDebugger::ProcessCdlRead(uint32_t addr, uint8_t value, MemoryOperationType type)
+{
+	//The SPC has no CDL, only keep track of the last operation
+	InstructionProgress.LastMemOperation = MemoryOperationInfo(addr, value, type, MemoryType::SpcMemory);
+}
+
+void SpcDebugger::ProcessCdlWrite(uint32_t addr, uint8_t value, MemoryOperationType type)
+{
+	InstructionProgress.LastMemOperation = MemoryOperationInfo(addr, value, type, MemoryType::SpcMemory);
+
+	//Always invalidate cache, even if DSP writes are ignored
+	_disassembler->InvalidateCache({ (int32_t)addr, MemoryType::SpcRam }, CpuType::Spc);
+}
+
 void SpcDebugger::Run()
 {
 	_step.reset(new StepRequest());
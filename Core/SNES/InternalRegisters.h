@@ -49,6 +49,7 @@ public:
 	uint8_t GetIoPortOutput();
 	void SetNmiFlag(bool nmiFlag);
 
+	bool IsIrqCounterIdle() { return !_state.EnableHorizontalIrq && !_state.EnableVerticalIrq && _needIrq == 0; }
 	bool IsVerticalIrqEnabled() { return _state.EnableVerticalIrq; }
 	bool IsHorizontalIrqEnabled() { return _state.EnableHorizontalIrq; }
 	bool IsNmiEnabled() { return _state.EnableNmi; }
@@ -23,6 +23,7 @@
 #include "SNES/Coprocessors/SA1/Sa1.h"
 #include "SNES/Coprocessors/GSU/Gsu.h"
 #include "SNES/Coprocessors/CX4/Cx4.h"
+#include "SNES/Coprocessors/SGB/SuperGameboy.h"
 #include "Shared/Emulator.h"
 #include "Shared/TimingInfo.h"
 #include "Shared/EmuSettings.h"
@@ -58,12 +59,25 @@ void SnesConsole::Release()
 void SnesConsole::RunFrame()
 {
 	UpdateRegion();
+	_spc->UpdateThreadState();
+	_ppu->UpdateThreadState();
+
+	SuperGameboy* sgb = _cart->GetSuperGameboy();
+	if(sgb) {
+		sgb->UpdateThreadState();
+	}
 
 	_frameRunning = true;
 
 	while(_frameRunning) {
 		_cpu->Exec();
 	}
+
+	//Catch up the SPC (and the SGB's Game Boy), this ensures their threads are idle between frames (when save states, the debugger, etc. can be used)
+	_spc->Run();
+	if(sgb) {
+		sgb->Synchronize();
+	}
 }
 
 void SnesConsole::ProcessEndOfFrame()
@@ -76,7 +90,7 @@ void SnesConsole::ProcessEndOfFrame()
 	_emu->ProcessEndOfFrame();
 
 	_controlManager->UpdateControlDevices();
-	_controlManager->UpdateInputState();
+	_controlManager->RequestInputUpdate();
 	_internalRegisters->SetAutoJoypadReadClock();
 	_frameRunning = false;
 }
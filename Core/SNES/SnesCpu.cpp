@@ -80,6 +80,13 @@ void SnesCpu::ProcessHaltedState()
 			Idle();
 			_state.StopState = SnesCpuStopState::Running;
 			CheckForInterrupts();
+		} else {
+#ifndef DUMMYCPU
+			if(!_emu->IsDebugging()) {
+				//No interrupt can occur before the next scanline event, skip the idle cycles in a single step
+				_state.CycleCount += _memoryManager->SkipIdleCycles();
+			}
+#endif
 		}
 	}
 }
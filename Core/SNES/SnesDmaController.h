@@ -50,6 +50,7 @@ public:
 	void BeginHdmaInit();
 
 	bool ProcessPendingTransfers();
+	bool HasPendingTransfers() { return _needToProcess; }
 
 	void Write(uint16_t addr, uint8_t value);
 	uint8_t Read(uint16_t addr);
@@ -173,6 +173,21 @@ void SnesMemoryManager::IncrementMasterClockValue(uint16_t cyclesToRun)
 	}
 }
 
+uint32_t SnesMemoryManager::SkipIdleCycles()
+{
+	//Used while the CPU is waiting for an interrupt (WAI): skip ahead in blocks of 6 master clocks (one idle cycle)
+	//until just before the next scanline event. Nothing can wake the CPU before that event unless an IRQ
+	//is pending/enabled, a DMA is pending, or a coprocessor needs to run in lockstep with the CPU.
+	if(_hClock >= _nextEventClock || !_regs->IsIrqCounterIdle() || _cart->NeedCoprocessorSync() || _console->GetDmaController()->HasPendingTransfers()) {
+		return 0;
+	}
+
+	uint32_t cycles = (_nextEventClock - _hClock - 1) / 6;
+	_masterClock += cycles * 6;
+	_hClock += cycles * 6;
+	return cycles;
+}
+
 void SnesMemoryManager::Exec()
 {
 	_masterClock += 2;
@@ -77,6 +77,7 @@ public:
 	void IncMasterClock40();
 	void IncMasterClockStartup();
 	void IncrementMasterClockValue(uint16_t value);
+	uint32_t SkipIdleCycles();
 
 	uint8_t Read(uint32_t addr, MemoryOperationType type);
 	uint8_t ReadDma(uint32_t addr, bool forBusA);
@@ -22,6 +22,30 @@
 #include "Utilities/HexUtilities.h"
 #include "Utilities/Serializer.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define MESEN_PPU_SSE
+
+template<int shift>
+static __forceinline __m128i AddColorChannel(__m128i a, __m128i b, __m128i halveMask)
+{
+	const __m128i channelMask = _mm_set1_epi16(0x1F);
+	__m128i sum = _mm_add_epi16(_mm_and_si128(_mm_srli_epi16(a, shift), channelMask), _mm_and_si128(_mm_srli_epi16(b, shift), channelMask));
+	sum = _mm_or_si128(_mm_and_si128(halveMask, _mm_srli_epi16(sum, 1)), _mm_andnot_si128(halveMask, sum));
+	return _mm_slli_epi16(_mm_min_epi16(sum, channelMask), shift);
+}
+
+template<int shift>
+static __forceinline __m128i SubtractColorChannel(__m128i a, __m128i b, __m128i halveMask)
+{
+	const __m128i channelMask = _mm_set1_epi16(0x1F);
+	__m128i diff = _mm_sub_epi16(_mm_and_si128(_mm_srli_epi16(a, shift), channelMask), _mm_and_si128(_mm_srli_epi16(b, shift), channelMask));
+	diff = _mm_max_epi16(diff, _mm_setzero_si128());
+	diff = _mm_or_si128(_mm_and_si128(halveMask, _mm_srli_epi16(diff, 1)), _mm_andnot_si128(halveMask, diff));
+	return _mm_slli_epi16(diff, shift);
+}
+#endif
+
 SnesPpu::SnesPpu(Emulator* emu, SnesConsole* console)
 {
 	_emu = emu;
@@ -37,10 +61,16 @@ SnesPpu::SnesPpu(Emulator* emu, SnesConsole* console)
 	_outputBuffers[1] = new uint16_t[512 * 478];
 	memset(_outputBuffers[0], 0, 512 * 478 * sizeof(uint16_t));
 	memset(_outputBuffers[1], 0, 512 * 478 * sizeof(uint16_t));
+
+	_composeLines.reset(new ComposeLine[SnesPpu::ComposeQueueSize]());
+	_stopComposeThread = false;
+	_composeHead = 0;
+	_composeTail = 0;
 }
 
 SnesPpu::~SnesPpu()
 {
+	StopComposeThread();
 	delete[] _vram;
 	delete[] _outputBuffers[0];
 	delete[] _outputBuffers[1];
@@ -399,6 +429,9 @@ bool SnesPpu::ProcessEndOfScanline(uint16_t& hClock)
 		//"In non-interlace mode scanline 240 of every other frame (those with $213f.7=1) is only 1360 cycles."
 		if(_scanline < _vblankStartScanline) {
 			RenderScanline();
+			if(_useComposeThread) {
+				QueueComposeLine();
+			}
 
 			if(_scanline == 0) {
 				_overscanFrame = _state.OverscanMode;
@@ -480,6 +513,7 @@ bool SnesPpu::ProcessEndOfScanline(uint16_t& hClock)
 			_frameCount++;
 			_spc->ProcessEndFrame();
 			_regs->SetNmiFlag(true);
+			WaitForComposition();
 			SendFrame();
 
 			_console->ProcessEndOfFrame();
@@ -510,6 +544,7 @@ bool SnesPpu::ProcessEndOfScanline(uint16_t& hClock)
 		}
 
 		UpdateSpcState();
+		_spc->RunAsync();
 		return true;
 	}
 	return false;
@@ -897,9 +932,17 @@ void SnesPpu::RenderScanline()
 			RenderBgColor();
 		}
 
-		ApplyColorMath();
-		ApplyBrightness<true>();
-		ApplyHiResMode();
+		if(_emu->IsDebugging()) {
+			DebugProcessMainSubScreenViews();
+		}
+
+		if(_useComposeThread) {
+			QueueComposeSegment();
+		} else {
+			ComposeSegment segment;
+			CaptureComposeSegment(segment);
+			Compose(segment, _mainScreenBuffer, _mainScreenFlags, _subScreenBuffer, _subScreenPriority);
+		}
 
 		_drawStartX = _drawEndX + 1;
 	}
@@ -1261,42 +1304,139 @@ void SnesPpu::DrawSubPixel(uint8_t x, uint16_t color, uint8_t priority)
 	_subScreenPriority[x] = priority;
 }
 
-void SnesPpu::ApplyColorMath()
+void SnesPpu::CaptureComposeSegment(ComposeSegment& segment)
 {
-	if(!_skipRender && _emu->IsDebugging()) {
-		DebugProcessMainSubScreenViews();
+	segment.StartX = _drawStartX;
+	segment.EndX = _drawEndX;
+
+	//When overscan mode is off, center the 224-line picture in the center of the 239-line output buffer
+	segment.OutputBuffer = _currentBuffer;
+	segment.OutputScanline = _overscanFrame ? (_scanline - 1) : (_scanline + 6);
+	segment.UseHighResOutput = _useHighResOutput;
+	segment.ScreenInterlace = _state.ScreenInterlace;
+	segment.OddFrame = _oddFrame;
+	if(_useHighResOutput) {
+		_interlacedFrame |= _state.ScreenInterlace;
 	}
 
-	uint8_t activeWindowCount = (uint8_t)_state.Window[0].ActiveLayers[SnesPpu::ColorWindowIndex] + (uint8_t)_state.Window[1].ActiveLayers[SnesPpu::ColorWindowIndex];
-	bool hiResMode = _state.HiResMode || _state.BgMode == 5 || _state.BgMode == 6;
+	segment.Window[0] = _state.Window[0];
+	segment.Window[1] = _state.Window[1];
+	segment.MaskLogic = _state.MaskLogic[SnesPpu::ColorWindowIndex];
+	segment.ColorMathClipMode = _state.ColorMathClipMode;
+	segment.ColorMathPreventMode = _state.ColorMathPreventMode;
+	segment.ColorMathAddSubscreen = _state.ColorMathAddSubscreen;
+	segment.ColorMathSubtractMode = _state.ColorMathSubtractMode;
+	segment.ColorMathHalveResult = _state.ColorMathHalveResult;
+	segment.FixedColor = _state.FixedColor;
+	segment.ScreenBrightness = _state.ScreenBrightness;
+	segment.DoubleWidth = IsDoubleWidth();
+}
 
-	if(hiResMode) {
-		for(int x = _drawStartX; x <= _drawEndX; x++) {
-			bool isInsideWindow = ProcessMaskWindow<SnesPpu::ColorWindowIndex>(activeWindowCount, x);
+void SnesPpu::Compose(const ComposeSegment& segment, uint16_t* mainBuffer, uint8_t* mainFlags, uint16_t* subBuffer, uint8_t* subPriority)
+{
+	//Only uses the segment's values and the given buffers, this can run on the compositing thread
+	ApplyColorMath(segment, mainBuffer, mainFlags, subBuffer, subPriority);
+	ApplyBrightness(segment, mainBuffer);
+	ApplyHiResMode(segment, mainBuffer, subBuffer);
+}
 
-			//Keep original subscreen color, which is used to apply color math to the main screen after
-			uint16_t subPixel = _subScreenBuffer[x];
-			//Apply the color math based on the previous main pixel
-			uint16_t prevMainPixel = x > 0 ? _mainScreenBuffer[x - 1] : 0;
-			int prevX = x > 0 ? x - 1 : 0;
-			ApplyColorMathToPixel(_subScreenBuffer[x], prevMainPixel, prevX, isInsideWindow);
+void SnesPpu::ApplyColorMath(const ComposeSegment& segment, uint16_t* mainBuffer, uint8_t* mainFlags, uint16_t* subBuffer, uint8_t* subPriority)
+{
+	//Calculate the color window for the whole segment first, the color math is then applied to multiple pixels at once
+	uint8_t windowMask[256];
+	uint8_t activeWindowCount = (uint8_t)segment.Window[0].ActiveLayers[SnesPpu::ColorWindowIndex] + (uint8_t)segment.Window[1].ActiveLayers[SnesPpu::ColorWindowIndex];
+	for(int x = segment.StartX; x <= segment.EndX; x++) {
+		windowMask[x] = ProcessMaskWindow<SnesPpu::ColorWindowIndex>(segment.Window, segment.MaskLogic, activeWindowCount, x) ? 0xFF : 0;
+	}
+
+	int startX = segment.StartX;
+	int count = segment.EndX - segment.StartX + 1;
+	ApplyColorMathToPixels(segment, mainBuffer + startX, subBuffer + startX, mainFlags + startX, subPriority + startX, windowMask + startX, count);
 
-			ApplyColorMathToPixel(_mainScreenBuffer[x], subPixel, x, isInsideWindow);
+	if(segment.DoubleWidth) {
+		//In hi-res modes, the subscreen pixels are blended with the previous main screen pixel (after its own color math was applied)
+		//The main screen pixels were processed above, using the original subscreen colors
+		if(startX == 0) {
+			ApplyColorMathToPixel(segment, subBuffer[0], 0, mainFlags[0], subPriority[0], windowMask[0] != 0);
+			startX++;
+			count--;
 		}
-	} else {
-		for(int x = _drawStartX; x <= _drawEndX; x++) {
-			bool isInsideWindow = ProcessMaskWindow<SnesPpu::ColorWindowIndex>(activeWindowCount, x);
-			ApplyColorMathToPixel(_mainScreenBuffer[x], _subScreenBuffer[x], x, isInsideWindow);
+		ApplyColorMathToPixels(segment, subBuffer + startX, mainBuffer + startX - 1, mainFlags + startX - 1, subPriority + startX - 1, windowMask + startX, count);
+	}
+}
+
+void SnesPpu::ApplyColorMathToPixels(const ComposeSegment& segment, uint16_t* pixelsA, const uint16_t* pixelsB, const uint8_t* pixelFlags, const uint8_t* subPriority, const uint8_t* windowMask, int count)
+{
+	int i = 0;
+
+#ifdef MESEN_PPU_SSE
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i all = _mm_set1_epi16(-1);
+	const __m128i fixedColor = _mm_set1_epi16((int16_t)segment.FixedColor);
+	const __m128i allowColorMath = _mm_set1_epi16(PixelFlags::AllowColorMath);
+	const __m128i halve = segment.ColorMathHalveResult ? all : zero;
+
+	//Clip/prevent masks are calculated as (insideWindow & insideMask) ^ invertMask, based on the window mode
+	auto getModeMasks = [&](ColorWindowMode mode, __m128i& insideMask, __m128i& invertMask) {
+		insideMask = (mode == ColorWindowMode::OutsideWindow || mode == ColorWindowMode::InsideWindow) ? all : zero;
+		invertMask = (mode == ColorWindowMode::OutsideWindow || mode == ColorWindowMode::Always) ? all : zero;
+	};
+
+	__m128i clipInside, clipInvert, preventInside, preventInvert;
+	getModeMasks(segment.ColorMathClipMode, clipInside, clipInvert);
+	getModeMasks(segment.ColorMathPreventMode, preventInside, preventInvert);
+
+	for(; i + 8 <= count; i += 8) {
+		__m128i window = _mm_loadl_epi64((const __m128i*)(windowMask + i));
+		window = _mm_unpacklo_epi8(window, window);
+		__m128i flags = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(pixelFlags + i)), zero);
+		__m128i priority = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(subPriority + i)), zero);
+
+		__m128i clip = _mm_xor_si128(_mm_and_si128(window, clipInside), clipInvert);
+		__m128i prevent = _mm_xor_si128(_mm_and_si128(window, preventInside), preventInvert);
+		__m128i apply = _mm_andnot_si128(prevent, _mm_cmpeq_epi16(_mm_and_si128(flags, allowColorMath), allowColorMath));
+
+		//Clipping to black disables the halve operation, except in "always" mode
+		__m128i halveMask = _mm_andnot_si128(_mm_and_si128(clip, clipInside), halve);
+
+		__m128i a = _mm_andnot_si128(clip, _mm_loadu_si128((const __m128i*)(pixelsA + i)));
+		__m128i b = fixedColor;
+		if(segment.ColorMathAddSubscreen) {
+			//Use the fixed color (and don't halve the result) when there's nothing in the subscreen
+			__m128i hasSubPixel = _mm_andnot_si128(_mm_cmpeq_epi16(priority, zero), all);
+			b = _mm_or_si128(_mm_and_si128(hasSubPixel, _mm_loadu_si128((const __m128i*)(pixelsB + i))), _mm_andnot_si128(hasSubPixel, fixedColor));
+			halveMask = _mm_and_si128(halveMask, hasSubPixel);
+		}
+
+		__m128i result;
+		if(segment.ColorMathSubtractMode) {
+			result = _mm_or_si128(
+				_mm_or_si128(SubtractColorChannel<0>(a, b, halveMask), SubtractColorChannel<5>(a, b, halveMask)),
+				SubtractColorChannel<10>(a, b, halveMask)
+			);
+		} else {
+			result = _mm_or_si128(
+				_mm_or_si128(AddColorChannel<0>(a, b, halveMask), AddColorChannel<5>(a, b, halveMask)),
+				AddColorChannel<10>(a, b, halveMask)
+			);
 		}
+
+		result = _mm_or_si128(_mm_and_si128(apply, result), _mm_andnot_si128(apply, a));
+		_mm_storeu_si128((__m128i*)(pixelsA + i), result);
+	}
+#endif
+
+	for(; i < count; i++) {
+		ApplyColorMathToPixel(segment, pixelsA[i], pixelsB[i], pixelFlags[i], subPriority[i], windowMask[i] != 0);
 	}
 }
 
-void SnesPpu::ApplyColorMathToPixel(uint16_t &pixelA, uint16_t pixelB, int x, bool isInsideWindow)
+void SnesPpu::ApplyColorMathToPixel(const ComposeSegment& segment, uint16_t &pixelA, uint16_t pixelB, uint8_t pixelFlags, uint8_t subPriority, bool isInsideWindow)
 {
-	uint8_t halfShift = (uint8_t)_state.ColorMathHalveResult;
+	uint8_t halfShift = (uint8_t)segment.ColorMathHalveResult;
 
 	//Set color to black as needed based on clip mode
-	switch(_state.ColorMathClipMode) {
+	switch(segment.ColorMathClipMode) {
 		default:
 		case ColorWindowMode::Never: break;
 
@@ -1317,13 +1457,13 @@ void SnesPpu::ApplyColorMathToPixel(uint16_t &pixelA, uint16_t pixelB, int x, bo
 		case ColorWindowMode::Always: pixelA = 0; break;
 	}
 
-	if(!(_mainScreenFlags[x] & PixelFlags::AllowColorMath)) {
+	if(!(pixelFlags & PixelFlags::AllowColorMath)) {
 		//Color math doesn't apply to this pixel
 		return;
 	}
 
 	//Prevent color math as needed based on mode
-	switch(_state.ColorMathPreventMode) {
+	switch(segment.ColorMathPreventMode) {
 		default:
 		case ColorWindowMode::Never: break;
 
@@ -1343,20 +1483,20 @@ void SnesPpu::ApplyColorMathToPixel(uint16_t &pixelA, uint16_t pixelB, int x, bo
 	}
 
 	uint16_t otherPixel;
-	if(_state.ColorMathAddSubscreen) {
-		if(_subScreenPriority[x] > 0) {
+	if(segment.ColorMathAddSubscreen) {
+		if(subPriority > 0) {
 			otherPixel = pixelB;
 		} else {
 			//there's nothing in the subscreen at this pixel, use the fixed color and disable halve operation
-			otherPixel = _state.FixedColor;
+			otherPixel = segment.FixedColor;
 			halfShift = 0;
 		}
 	} else {
-		otherPixel = _state.FixedColor;
+		otherPixel = segment.FixedColor;
 	}
 
 	constexpr unsigned int mask = 0x1F;
-	if(_state.ColorMathSubtractMode) {
+	if(segment.ColorMathSubtractMode) {
 		uint16_t r = std::max((int)((pixelA & mask) - (otherPixel & mask)), 0) >> halfShift;
 		uint16_t g = std::max((int)(((pixelA >> 5U) & mask) - ((otherPixel >> 5U) & mask)), 0) >> halfShift;
 		uint16_t b = std::max((int)(((pixelA >> 10U) & mask) - ((otherPixel >> 10U) & mask)), 0) >> halfShift;
@@ -1371,20 +1511,141 @@ void SnesPpu::ApplyColorMathToPixel(uint16_t &pixelA, uint16_t pixelB, int x, bo
 	}
 }
 
-template<bool forMainScreen>
-void SnesPpu::ApplyBrightness()
+void SnesPpu::ApplyBrightness(const ComposeSegment& segment, uint16_t* buffer)
 {
-	if(_state.ScreenBrightness != 15) {
-		for(int x = _drawStartX; x <= _drawEndX; x++) {
-			uint16_t &pixel = (forMainScreen ? _mainScreenBuffer : _subScreenBuffer)[x];
-			uint16_t r = (pixel & 0x1F) * _state.ScreenBrightness / 15;
-			uint16_t g = ((pixel >> 5) & 0x1F) * _state.ScreenBrightness / 15;
-			uint16_t b = ((pixel >> 10) & 0x1F) * _state.ScreenBrightness / 15;
+	if(segment.ScreenBrightness != 15) {
+		int x = segment.StartX;
+
+#ifdef MESEN_PPU_SSE
+		//(value * 0x8889) >> 19 is equal to value / 15 for all possible values (0 to 31*15)
+		const __m128i brightness = _mm_set1_epi16(segment.ScreenBrightness);
+		const __m128i divideBy15 = _mm_set1_epi16((int16_t)0x8889);
+		const __m128i channelMask = _mm_set1_epi16(0x1F);
+		for(; x + 8 <= segment.EndX + 1; x += 8) {
+			__m128i pixels = _mm_loadu_si128((__m128i*)(buffer + x));
+			__m128i r = _mm_and_si128(pixels, channelMask);
+			__m128i g = _mm_and_si128(_mm_srli_epi16(pixels, 5), channelMask);
+			__m128i b = _mm_and_si128(_mm_srli_epi16(pixels, 10), channelMask);
+			r = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(r, brightness), divideBy15), 3);
+			g = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(g, brightness), divideBy15), 3);
+			b = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(b, brightness), divideBy15), 3);
+			_mm_storeu_si128((__m128i*)(buffer + x), _mm_or_si128(r, _mm_or_si128(_mm_slli_epi16(g, 5), _mm_slli_epi16(b, 10))));
+		}
+#endif
+
+		for(; x <= segment.EndX; x++) {
+			uint16_t &pixel = buffer[x];
+			uint16_t r = (pixel & 0x1F) * segment.ScreenBrightness / 15;
+			uint16_t g = ((pixel >> 5) & 0x1F) * segment.ScreenBrightness / 15;
+			uint16_t b = ((pixel >> 10) & 0x1F) * segment.ScreenBrightness / 15;
 			pixel = r | (g << 5) | (b << 10);
 		}
 	}
 }
 
+void SnesPpu::QueueComposeSegment()
+{
+	uint32_t head = _composeHead.load(std::memory_order_relaxed);
+	if(head - _composeTail.load(std::memory_order_acquire) >= SnesPpu::ComposeQueueSize) {
+		//Queue is full, wait for the compositing thread to catch up
+		auto lock = _composeLock.AcquireSafe();
+		ProcessComposeQueue();
+	}
+
+	ComposeLine& line = _composeLines[head & (SnesPpu::ComposeQueueSize - 1)];
+	CaptureComposeSegment(line.Segments[line.SegmentCount]);
+	line.SegmentCount++;
+}
+
+void SnesPpu::QueueComposeLine()
+{
+	//Called at the end of each scanline, once all of the scanline's pixels have been drawn
+	uint32_t head = _composeHead.load(std::memory_order_relaxed);
+	ComposeLine& line = _composeLines[head & (SnesPpu::ComposeQueueSize - 1)];
+	if(line.SegmentCount == 0) {
+		return;
+	}
+
+	memcpy(line.MainScreenFlags, _mainScreenFlags, sizeof(_mainScreenFlags));
+	memcpy(line.MainScreenBuffer, _mainScreenBuffer, sizeof(_mainScreenBuffer));
+	memcpy(line.SubScreenPriority, _subScreenPriority, sizeof(_subScreenPriority));
+	memcpy(line.SubScreenBuffer, _subScreenBuffer, sizeof(_subScreenBuffer));
+
+	_composeHead.store(head + 1, std::memory_order_release);
+	_composeSignal.Signal();
+}
+
+void SnesPpu::ProcessComposeQueue()
+{
+	//Must be called while holding _composeLock
+	uint32_t head = _composeHead.load(std::memory_order_acquire);
+	uint32_t tail = _composeTail.load(std::memory_order_relaxed);
+
+	while(tail != head) {
+		ComposeLine& line = _composeLines[tail & (SnesPpu::ComposeQueueSize - 1)];
+		for(uint32_t i = 0; i < line.SegmentCount; i++) {
+			Compose(line.Segments[i], line.MainScreenBuffer, line.MainScreenFlags, line.SubScreenBuffer, line.SubScreenPriority);
+		}
+		line.SegmentCount = 0;
+		tail++;
+		_composeTail.store(tail, std::memory_order_release);
+	}
+}
+
+void SnesPpu::WaitForComposition()
+{
+	//Ensures everything drawn so far (including the current scanline) is in the frame buffer
+	if(!_useComposeThread) {
+		return;
+	}
+
+	auto lock = _composeLock.AcquireSafe();
+	ProcessComposeQueue();
+
+	ComposeLine& line = _composeLines[_composeHead & (SnesPpu::ComposeQueueSize - 1)];
+	for(uint32_t i = 0; i < line.SegmentCount; i++) {
+		Compose(line.Segments[i], _mainScreenBuffer, _mainScreenFlags, _subScreenBuffer, _subScreenPriority);
+	}
+	line.SegmentCount = 0;
+}
+
+void SnesPpu::ComposeThreadLoop()
+{
+	while(!_stopComposeThread) {
+		_composeSignal.Wait();
+		if(_stopComposeThread) {
+			break;
+		}
+
+		auto lock = _composeLock.AcquireSafe();
+		ProcessComposeQueue();
+	}
+}
+
+void SnesPpu::StopComposeThread()
+{
+	if(_composeThread.joinable()) {
+		_stopComposeThread = true;
+		_composeSignal.Signal();
+		_composeThread.join();
+	}
+}
+
+void SnesPpu::UpdateThreadState()
+{
+	//Called between frames - the debugger's main/sub screen views need the scanline's data before it is composed,
+	//so the compositing is always done on the emulation thread when the debugger is active
+	bool useThread = _settings->GetSnesConfig().RunPpuCompositingOnSeparateThread && !_emu->IsDebugging();
+	if(useThread != _useComposeThread) {
+		WaitForComposition();
+		if(useThread && !_composeThread.joinable()) {
+			_stopComposeThread = false;
+			_composeThread = std::thread(&SnesPpu::ComposeThreadLoop, this);
+		}
+		_useComposeThread = useThread;
+	}
+}
+
 void SnesPpu::ConvertToHiRes()
 {
 	if(_skipRender) {
@@ -1396,6 +1657,9 @@ void SnesPpu::ConvertToHiRes()
 		return;
 	}
 
+	//The rows drawn so far are converted below, they need to be in the frame buffer first
+	WaitForComposition();
+
 	//Convert standard res picture to high resolution when the PPU starts drawing in high res mid frame
 	_useHighResOutput = useHighResOutput;
 
@@ -1418,59 +1682,77 @@ void SnesPpu::ConvertToHiRes()
 	}
 }
 
-void SnesPpu::ApplyHiResMode()
+void SnesPpu::ApplyHiResMode(const ComposeSegment& segment, uint16_t* mainBuffer, uint16_t* subBuffer)
 {
-	//When overscan mode is off, center the 224-line picture in the center of the 239-line output buffer
-	uint16_t scanline = _overscanFrame ? (_scanline - 1) : (_scanline + 6);
+	uint16_t scanline = segment.OutputScanline;
+	uint16_t* outputBuffer = segment.OutputBuffer;
+	int startX = segment.StartX;
+	int endX = segment.EndX;
 
-	if(!_useHighResOutput) {
-		memcpy(_currentBuffer + (scanline << 8) + _drawStartX, _mainScreenBuffer + _drawStartX, (_drawEndX - _drawStartX + 1) << 1);
+	if(!segment.UseHighResOutput) {
+		memcpy(outputBuffer + (scanline << 8) + startX, mainBuffer + startX, (endX - startX + 1) << 1);
 	} else {
-		_interlacedFrame |= _state.ScreenInterlace;
-		uint32_t screenY = _state.ScreenInterlace ? (_oddFrame ? ((scanline << 1) + 1) : (scanline << 1)) : (scanline << 1);
+		uint32_t screenY = segment.ScreenInterlace ? (segment.OddFrame ? ((scanline << 1) + 1) : (scanline << 1)) : (scanline << 1);
 		uint32_t baseAddr = (screenY << 9);
 
-		if(IsDoubleWidth()) {
-			ApplyBrightness<false>();
-			for(int x = _drawStartX; x <= _drawEndX; x++) {
-				_currentBuffer[baseAddr + (x << 1)] = _subScreenBuffer[x];
-				_currentBuffer[baseAddr + (x << 1) + 1] = _mainScreenBuffer[x];
-			}
+		if(segment.DoubleWidth) {
+			ApplyBrightness(segment, subBuffer);
+			InterleavePixels(outputBuffer + baseAddr + (startX << 1), subBuffer + startX, mainBuffer + startX, endX - startX + 1);
 		} else {
-			for(int x = _drawStartX; x <= _drawEndX; x++) {
-				_currentBuffer[baseAddr + (x << 1)] = _mainScreenBuffer[x];
-				_currentBuffer[baseAddr + (x << 1) + 1] = _mainScreenBuffer[x];
-			}
+			InterleavePixels(outputBuffer + baseAddr + (startX << 1), mainBuffer + startX, mainBuffer + startX, endX - startX + 1);
 		}
 
-		if(!_state.ScreenInterlace) {
+		if(!segment.ScreenInterlace) {
 			//Copy this line's content to the next line (between the current start & end bounds)
 			memcpy(
-				_currentBuffer + baseAddr + 512 + (_drawStartX << 1),
-				_currentBuffer + baseAddr + (_drawStartX << 1),
-				(_drawEndX - _drawStartX + 1) << 2
+				outputBuffer + baseAddr + 512 + (startX << 1),
+				outputBuffer + baseAddr + (startX << 1),
+				(endX - startX + 1) << 2
 			);
 		}
 	}
 }
 
+void SnesPpu::InterleavePixels(uint16_t* out, const uint16_t* even, const uint16_t* odd, int count)
+{
+	int x = 0;
+#ifdef MESEN_PPU_SSE
+	for(; x + 8 <= count; x += 8) {
+		__m128i evenPixels = _mm_loadu_si128((const __m128i*)(even + x));
+		__m128i oddPixels = _mm_loadu_si128((const __m128i*)(odd + x));
+		_mm_storeu_si128((__m128i*)(out + (x << 1)), _mm_unpacklo_epi16(evenPixels, oddPixels));
+		_mm_storeu_si128((__m128i*)(out + (x << 1) + 8), _mm_unpackhi_epi16(evenPixels, oddPixels));
+	}
+#endif
+	for(; x < count; x++) {
+		out[x << 1] = even[x];
+		out[(x << 1) + 1] = odd[x];
+	}
+}
+
 template<uint8_t layerIndex>
 bool SnesPpu::ProcessMaskWindow(uint8_t activeWindowCount, int x)
+{
+	return ProcessMaskWindow<layerIndex>(_state.Window, _state.MaskLogic[layerIndex], activeWindowCount, x);
+}
+
+template<uint8_t layerIndex>
+bool SnesPpu::ProcessMaskWindow(const WindowConfig windows[2], WindowMaskLogic maskLogic, uint8_t activeWindowCount, int x)
 {
 	switch(activeWindowCount) {
 		case 1: 
-			if(_state.Window[0].ActiveLayers[layerIndex]) {
-				return _state.Window[0].PixelNeedsMasking<layerIndex>(x);
+			if(windows[0].ActiveLayers[layerIndex]) {
+				return windows[0].PixelNeedsMasking<layerIndex>(x);
 			}
-			return _state.Window[1].PixelNeedsMasking<layerIndex>(x);
+			return windows[1].PixelNeedsMasking<layerIndex>(x);
 
 		case 2:
-			switch(_state.MaskLogic[layerIndex]) {
+			switch(maskLogic) {
 				default:
-				case WindowMaskLogic::Or: return _state.Window[0].PixelNeedsMasking<layerIndex>(x) | _state.Window[1].PixelNeedsMasking<layerIndex>(x);
-				case WindowMaskLogic::And: return _state.Window[0].PixelNeedsMasking<layerIndex>(x) & _state.Window[1].PixelNeedsMasking<layerIndex>(x);
-				case WindowMaskLogic::Xor: return _state.Window[0].PixelNeedsMasking<layerIndex>(x) ^ _state.Window[1].PixelNeedsMasking<layerIndex>(x);
-				case WindowMaskLogic::Xnor: return !(_state.Window[0].PixelNeedsMasking<layerIndex>(x) ^ _state.Window[1].PixelNeedsMasking<layerIndex>(x));
+				case WindowMaskLogic::Or: return windows[0].PixelNeedsMasking<layerIndex>(x) | windows[1].PixelNeedsMasking<layerIndex>(x);
+				case WindowMaskLogic::And: return windows[0].PixelNeedsMasking<layerIndex>(x) & windows[1].PixelNeedsMasking<layerIndex>(x);
+				case WindowMaskLogic::Xor: return windows[0].PixelNeedsMasking<layerIndex>(x) ^ windows[1].PixelNeedsMasking<layerIndex>(x);
+				case WindowMaskLogic::Xnor: return !(windows[0].PixelNeedsMasking<layerIndex>(x) ^ windows[1].PixelNeedsMasking<layerIndex>(x));
 			}
 	}
 	return false;
@@ -1523,6 +1805,7 @@ void SnesPpu::DebugSendFrame()
 	if(_scanline < _vblankStartScanline) {
 		RenderScanline();
 	}
+	WaitForComposition();
 
 	uint16_t width = _useHighResOutput ? 512 : 256;
 	uint16_t height = _useHighResOutput ? 478 : 239;
@@ -2219,6 +2502,8 @@ void SnesPpu::Write(uint32_t addr, uint8_t value)
 
 void SnesPpu::Serialize(Serializer &s)
 {
+	WaitForComposition();
+
 	SV(_state.ForcedBlank); SV(_state.ScreenBrightness); SV(_scanline); SV(_frameCount);  SV(_state.BgMode);
 	SV(_state.Mode1Bg3Priority); SV(_state.MainScreenLayers); SV(_state.SubScreenLayers); SV(_state.VramAddress); SV(_state.VramIncrementValue); SV(_state.VramAddressRemapping);
 	SV(_state.VramAddrIncrementOnSecondReg); SV(_state.VramReadBuffer); SV(_state.Ppu1OpenBus); SV(_state.Ppu2OpenBus); SV(_state.CgramAddress); SV(_state.MosaicSize); SV(_state.MosaicEnabled);
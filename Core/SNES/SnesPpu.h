@@ -3,6 +3,9 @@
 #include "SNES/SnesPpuTypes.h"
 #include "Utilities/ISerializable.h"
 #include "Utilities/Timer.h"
+#include "Utilities/SimpleLock.h"
+#include "Utilities/AutoResetEvent.h"
+#include <thread>
 
 class Emulator;
 class SnesConsole;
@@ -22,6 +25,46 @@ private:
 	constexpr static int SpriteLayerIndex = 4;
 	constexpr static int ColorWindowIndex = 5;
 
+	//Number of scanlines that can be waiting to be composed by the compositing thread
+	constexpr static uint32_t ComposeQueueSize = 8;
+
+	//Register values used by the compositing steps (color math, brightness and output to the frame buffer)
+	//Captured each time a part of the scanline is drawn, since these registers can change mid-scanline
+	struct ComposeSegment
+	{
+		uint16_t StartX;
+		uint16_t EndX;
+
+		uint16_t* OutputBuffer;
+		uint16_t OutputScanline;
+		bool UseHighResOutput;
+		bool ScreenInterlace;
+		bool OddFrame;
+
+		WindowConfig Window[2];
+		WindowMaskLogic MaskLogic;
+		ColorWindowMode ColorMathClipMode;
+		ColorWindowMode ColorMathPreventMode;
+		bool ColorMathAddSubscreen;
+		bool ColorMathSubtractMode;
+		bool ColorMathHalveResult;
+		uint16_t FixedColor;
+		uint8_t ScreenBrightness;
+		bool DoubleWidth;
+	};
+
+	//A scanline's main/sub screen data (after all layers were drawn), waiting to be composed
+	struct ComposeLine
+	{
+		uint8_t MainScreenFlags[256];
+		uint16_t MainScreenBuffer[256];
+		uint8_t SubScreenPriority[256];
+		uint16_t SubScreenBuffer[256];
+
+		ComposeSegment Segments[256];
+		uint32_t SegmentCount;
+	};
+
 	Emulator* _emu;
 	SnesConsole* _console;
 	InternalRegisters* _regs;
@@ -122,6 +165,18 @@ private:
 
 	bool _needFullFrame = false;
 
+	//When enabled, the compositing steps are done by another thread, one scanline behind the emulation.
+	//The emulation thread fills the ComposeLine at _composeHead and queues it at the end of the scanline.
+	//Composing is always done while holding _composeLock (by either thread)
+	bool _useComposeThread = false;
+	std::thread _composeThread;
+	atomic<bool> _stopComposeThread;
+	AutoResetEvent _composeSignal;
+	SimpleLock _composeLock;
+	unique_ptr<ComposeLine[]> _composeLines;
+	atomic<uint32_t> _composeHead;
+	atomic<uint32_t> _composeTail;
+
 	void RenderSprites(const uint8_t priorities[4]);
 
 	template<bool hiResMode>
@@ -177,18 +232,31 @@ private:
 	__forceinline void DrawMainPixel(uint8_t x, uint16_t color, uint8_t flags);
 	__forceinline void DrawSubPixel(uint8_t x, uint16_t color, uint8_t priority);
 
-	void ApplyColorMath();
-	void ApplyColorMathToPixel(uint16_t &pixelA, uint16_t pixelB, int x, bool isInsideWindow);
-	
-	template<bool forMainScreen>
-	void ApplyBrightness();
+	void CaptureComposeSegment(ComposeSegment& segment);
+	void Compose(const ComposeSegment& segment, uint16_t* mainBuffer, uint8_t* mainFlags, uint16_t* subBuffer, uint8_t* subPriority);
+
+	void ApplyColorMath(const ComposeSegment& segment, uint16_t* mainBuffer, uint8_t* mainFlags, uint16_t* subBuffer, uint8_t* subPriority);
+	void ApplyColorMathToPixel(const ComposeSegment& segment, uint16_t &pixelA, uint16_t pixelB, uint8_t pixelFlags, uint8_t subPriority, bool isInsideWindow);
+	void ApplyColorMathToPixels(const ComposeSegment& segment, uint16_t* pixelsA, const uint16_t* pixelsB, const uint8_t* pixelFlags, const uint8_t* subPriority, const uint8_t* windowMask, int count);
+	void ApplyBrightness(const ComposeSegment& segment, uint16_t* buffer);
 
 	void ConvertToHiRes();
-	void ApplyHiResMode();
+	void ApplyHiResMode(const ComposeSegment& segment, uint16_t* mainBuffer, uint16_t* subBuffer);
+	static void InterleavePixels(uint16_t* out, const uint16_t* even, const uint16_t* odd, int count);
+
+	void QueueComposeSegment();
+	void QueueComposeLine();
+	void ProcessComposeQueue();
+	void WaitForComposition();
+	void ComposeThreadLoop();
+	void StopComposeThread();
 
 	template<uint8_t layerIndex>
 	bool ProcessMaskWindow(uint8_t activeWindowCount, int x);
 
+	template<uint8_t layerIndex>
+	static bool ProcessMaskWindow(const WindowConfig windows[2], WindowMaskLogic maskLogic, uint8_t activeWindowCount, int x);
+
 	void ProcessWindowMaskSettings(uint8_t value, uint8_t offset);
 
 	void UpdateVramReadBuffer();
@@ -223,6 +291,7 @@ public:
 	void Reset();
 
 	void RenderScanline();
+	void UpdateThreadState();
 
 	uint32_t GetFrameCount();
 	uint16_t GetRealScanline();
@@ -106,7 +106,7 @@ struct WindowConfig
 	uint8_t Right;
 
 	template<uint8_t layerIndex>
-	bool PixelNeedsMasking(int x)
+	bool PixelNeedsMasking(int x) const
 	{
 		if(InvertedLayers[layerIndex]) {
 			if(Left > Right) {
@@ -53,18 +53,104 @@ Spc::Spc(SnesConsole* console)
 	_enabled = true;
 	_spcSampleRate = Spc::SpcSampleRate + _emu->GetSettings()->GetSnesConfig().SpcClockSpeedAdjustment;
 
+	_stopThread = false;
+	_threadTargetCycle = 0;
+	_portWriteHead = 0;
+	_portWriteTail = 0;
+
 	UpdateClockRatio();
 }
 
 #ifndef DUMMYSPC
 Spc::~Spc()
 {
+	StopThread();
 	delete[] _ram;
 }
+
+void Spc::StopThread()
+{
+	if(_thread.joinable()) {
+		_stopThread = true;
+		_threadSignal.Signal();
+		_thread.join();
+	}
+}
+
+void Spc::ThreadLoop()
+{
+	while(!_stopThread) {
+		_threadSignal.Wait();
+		if(_stopThread) {
+			break;
+		}
+
+		auto lock = _runLock.AcquireSafe();
+		ProcessPendingWork();
+	}
+}
+
+void Spc::UpdateThreadState()
+{
+	//Must be called between frames - the debugger's callbacks can only be called from the emulation thread,
+	//so the SPC always runs on the emulation thread when the debugger is active
+	bool useThread = _emu->GetSettings()->GetSnesConfig().RunSpcOnSeparateThread && !_emu->IsDebugging();
+	if(useThread != _useThread) {
+		Run();
+		if(useThread && !_thread.joinable()) {
+			_stopThread = false;
+			_thread = std::thread(&Spc::ThreadLoop, this);
+		}
+		_useThread = useThread;
+	}
+}
 #endif
 
+void Spc::ProcessPendingWork()
+{
+	//Must be called while holding _runLock
+	//Load the target before the queue's head - any write queued before this target was set will be processed
+	uint64_t targetCycle = _threadTargetCycle.load(std::memory_order_acquire);
+	uint32_t head = _portWriteHead.load(std::memory_order_acquire);
+	uint32_t tail = _portWriteTail.load(std::memory_order_relaxed);
+
+	while(tail != head) {
+		PortWrite& write = _portWrites[tail & (PortWriteQueueSize - 1)];
+		RunUntil(write.Cycle);
+		_state.CpuRegs[write.Port] = write.Value;
+		tail++;
+		_portWriteTail.store(tail, std::memory_order_release);
+	}
+
+	RunUntil(targetCycle);
+}
+
+void Spc::SetThreadTarget(uint64_t targetCycle)
+{
+	_threadTargetCycle.store(targetCycle, std::memory_order_release);
+	if(targetCycle >= _lastSignaledCycle + ThreadRunInterval) {
+		_lastSignaledCycle = targetCycle;
+		_threadSignal.Signal();
+	}
+}
+
+void Spc::ClearThreadTarget()
+{
+	//Called (while holding _runLock) when the cycle counter is modified outside of the SPC's execution,
+	//otherwise the SPC thread could run up to a target that was calculated based on the old cycle counter
+	_threadTargetCycle = 0;
+	_lastSignaledCycle = 0;
+}
+
 void Spc::Reset()
 {
+	auto lock = _runLock.AcquireSafe();
+	if(_portWriteHead != _portWriteTail) {
+		//Apply any pending port writes before resetting
+		Run();
+	}
+	ClearThreadTarget();
+
 	_state.StopState = SnesCpuStopState::Running;
 
 	_state.Timer0.Reset();
@@ -110,6 +196,7 @@ void Spc::SetSpcState(bool enabled)
 {
 	//Used by overclocking logic to disable SPC during the extra scanlines added to the PPU
 	if(_enabled != enabled) {
+		auto lock = _runLock.AcquireSafe();
 		if(enabled) {
 			//When re-enabling, adjust the cycle counter to prevent running extra cycles
 			UpdateClockRatio();
@@ -132,12 +219,13 @@ void Spc::UpdateClockRatio()
 	if(std::abs((int64_t)targetCycle - (int64_t)_state.Cycle) > 20) {
 		_state.Cycle = targetCycle;
 	}
+	ClearThreadTarget();
 }
 
 void Spc::ExitExecLoop()
 {
 #ifndef DUMMYSPC
-	_state.Cycle = _memoryManager->GetMasterClock() * _clockRatio;
+	_state.Cycle = _runTargetCycle;
 #endif
 }
 
@@ -352,6 +440,20 @@ uint8_t Spc::CpuReadRegister(uint16_t addr)
 
 void Spc::CpuWriteRegister(uint32_t addr, uint8_t value)
 {
+	if(_useThread) {
+		//Queue the write, the SPC thread will apply it when it reaches this cycle
+		uint64_t targetCycle = GetTargetCycle();
+		uint32_t head = _portWriteHead.load(std::memory_order_relaxed);
+		if(head - _portWriteTail.load(std::memory_order_acquire) >= PortWriteQueueSize) {
+			//Queue is full, wait for the SPC to catch up
+			Run();
+		}
+		_portWrites[head & (PortWriteQueueSize - 1)] = { targetCycle, (uint8_t)(addr & 0x03), value };
+		_portWriteHead.store(head + 1, std::memory_order_release);
+		SetThreadTarget(targetCycle);
+		return;
+	}
+
 	Run();
 	_state.CpuRegs[addr & 0x03] = value;
 }
@@ -373,7 +475,33 @@ void Spc::DspWriteRam(uint16_t addr, uint8_t value)
 	_ram[addr] = value;
 }
 
+uint64_t Spc::GetTargetCycle()
+{
+	return (uint64_t)(_memoryManager->GetMasterClock() * _clockRatio);
+}
+
 void Spc::Run()
+{
+	uint64_t targetCycle = GetTargetCycle();
+	if(_useThread) {
+		//Catch up to the main CPU - the SPC thread might already be running, otherwise this thread runs the SPC
+		_threadTargetCycle.store(targetCycle, std::memory_order_release);
+		auto lock = _runLock.AcquireSafe();
+		ProcessPendingWork();
+	} else {
+		RunUntil(targetCycle);
+	}
+}
+
+void Spc::RunAsync()
+{
+	//Lets the SPC thread run up to the current cycle in the background
+	if(_useThread) {
+		SetThreadTarget(GetTargetCycle());
+	}
+}
+
+void Spc::RunUntil(uint64_t targetCycle)
 {
 	if(!_enabled) {
 		//Used to temporarily disable the SPC when overclocking is enabled
@@ -384,7 +512,7 @@ void Spc::Run()
 		return;
 	}
 
-	uint64_t targetCycle = (uint64_t)(_memoryManager->GetMasterClock() * _clockRatio);
+	_runTargetCycle = targetCycle;
 	while(_state.Cycle < targetCycle) {
 		ProcessCycle();
 	}
@@ -406,6 +534,7 @@ void Spc::ProcessCycle()
 
 void Spc::ProcessEndFrame()
 {
+	auto lock = _runLock.AcquireSafe();
 	Run();
 
 	UpdateClockRatio();
@@ -466,6 +595,7 @@ uint8_t* Spc::GetSpcRom()
 
 void Spc::Serialize(Serializer &s)
 {
+	auto lock = _runLock.AcquireSafe();
 	if(s.IsSaving() && s.GetFormat() != SerializeFormat::Map) {
 		//Catch up SPC to main CPU before creating the state
 		Run();
@@ -496,6 +626,8 @@ void Spc::Serialize(Serializer &s)
 
 	if(s.GetFormat() != SerializeFormat::Map) {
 		if(!s.IsSaving()) {
+			//Drop any writes queued before the state was loaded
+			_portWriteTail.store(_portWriteHead.load());
 			UpdateClockRatio();
 		}
 
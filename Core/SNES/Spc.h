@@ -12,6 +12,9 @@
 #include "SNES/SpcTimer.h"
 #include "Shared/MemoryOperationType.h"
 #include "Utilities/ISerializable.h"
+#include "Utilities/SimpleLock.h"
+#include "Utilities/AutoResetEvent.h"
+#include <thread>
 
 class SnesConsole;
 class Emulator;
@@ -31,6 +34,11 @@ private:
 	static constexpr int SampleBufferSize = 0x20000;
 	static constexpr uint16_t ResetVector = 0xFFFE;
 
+	//Max number of CPU writes to the APU ports that can be queued for the SPC thread
+	static constexpr uint32_t PortWriteQueueSize = 0x100;
+	//Minimum amount of SPC cycles to accumulate before waking up the SPC thread
+	static constexpr uint64_t ThreadRunInterval = 4096;
+
 	Emulator* _emu = nullptr;
 	SnesConsole* _console = nullptr;
 	SnesMemoryManager* _memoryManager = nullptr;
@@ -51,6 +59,33 @@ private:
 	bool _enabled = false;
 	uint32_t _spcSampleRate = Spc::SpcSampleRate;
 
+	//Target cycle for the current Run() call (used by STOP/SLEEP)
+	uint64_t _runTargetCycle = 0;
+
+	//When running on its own thread, the SPC only has to be in sync with the main CPU when the CPU
+	//reads the APU ports (and at the end of each frame). CPU writes to the ports are queued along
+	//with the cycle at which they occurred, and the SPC thread applies them at that exact cycle,
+	//which keeps the results identical to running everything on the emulation thread.
+	//All SPC/DSP execution is done while holding _runLock (by either thread).
+	struct PortWrite
+	{
+		uint64_t Cycle;
+		uint8_t Port;
+		uint8_t Value;
+	};
+
+	bool _useThread = false;
+	std::thread _thread;
+	atomic<bool> _stopThread;
+	AutoResetEvent _threadSignal;
+	SimpleLock _runLock;
+	atomic<uint64_t> _threadTargetCycle;
+	uint64_t _lastSignaledCycle = 0;
+
+	PortWrite _portWrites[PortWriteQueueSize] = {};
+	atomic<uint32_t> _portWriteHead;
+	atomic<uint32_t> _portWriteTail;
+
 	SpcState _state;
 	uint8_t* _ram;
 	uint8_t _spcBios[64] {
@@ -287,6 +322,15 @@ private:
 	void UpdateClockRatio();
 	void ExitExecLoop();
 
+	uint64_t GetTargetCycle();
+	void RunUntil(uint64_t targetCycle);
+
+	void ProcessPendingWork();
+	void SetThreadTarget(uint64_t targetCycle);
+	void ClearThreadTarget();
+	void ThreadLoop();
+	void StopThread();
+
 public:
 	Spc(SnesConsole* console);
 	virtual ~Spc();
@@ -294,6 +338,8 @@ public:
 	void SetSpcState(bool enabled);
 
 	void Run();
+	void RunAsync();
+	void UpdateThreadState();
 	void Reset();
 
 	uint8_t DebugRead(uint16_t addr);
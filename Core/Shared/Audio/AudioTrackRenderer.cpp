@@ -0,0 +1,272 @@
+#include "pch.h"
+#include <thread>
+#include "Shared/Audio/AudioTrackRenderer.h"
+#include "Shared/Audio/SoundMixer.h"
+#include "Shared/Audio/WaveRecorder.h"
+#include "Shared/Emulator.h"
+#include "Shared/EmuSettings.h"
+#include "Shared/RomInfo.h"
+#include "Utilities/FolderUtilities.h"
+#include "Utilities/VirtualFile.h"
+
+AudioTrackRenderer::AudioTrackRenderer(Emulator* emu, string outputFile, uint32_t trackNumber, bool checkTrackNumber, bool rawPcm)
+{
+	_emu = emu;
+	_outputFile = outputFile;
+	_trackNumber = trackNumber;
+	_checkTrackNumber = checkTrackNumber;
+	_rawPcm = rawPcm;
+	_done = false;
+}
+
+AudioTrackRenderer::~AudioTrackRenderer()
+{
+	CloseOutput();
+}
+
+void AudioTrackRenderer::OpenOutput()
+{
+	CloseOutput();
+
+	if(_rawPcm) {
+		_pcmStream = ofstream(_outputFile, ios::out | ios::binary);
+	} else {
+		_waveRecorder.reset(new WaveRecorder(_outputFile, _emu->GetSettings()->GetAudioConfig().SampleRate, true));
+	}
+
+	_sampleCount = 0;
+	_pendingSilence.clear();
+}
+
+void AudioTrackRenderer::CloseOutput()
+{
+	_waveRecorder.reset();
+	if(_pcmStream.is_open()) {
+		_pcmStream.close();
+	}
+}
+
+void AudioTrackRenderer::WriteSamples(int16_t* samples, uint32_t sampleCount, uint32_t sampleRate)
+{
+	if(sampleCount == 0) {
+		return;
+	}
+
+	if(_rawPcm) {
+		_pcmStream.write((char*)samples, sampleCount * 2 * sizeof(int16_t));
+	} else if(_waveRecorder) {
+		if(!_waveRecorder->WriteSamples(samples, sampleCount, sampleRate, true)) {
+			//Sample rate changed during playback
+			Finish(false);
+		}
+	}
+}
+
+void AudioTrackRenderer::Finish(bool success)
+{
+	if(!_done) {
+		CloseOutput();
+		_success = success;
+		_done = true;
+		_doneSignal.Signal();
+	}
+}
+
+void AudioTrackRenderer::ProcessSamples(int16_t* samples, uint32_t sampleCount, uint32_t sampleRate)
+{
+	if(_done) {
+		return;
+	}
+
+	AudioTrackInfo info = _emu->GetAudioTrackInfo();
+	if(_checkTrackNumber && info.TrackNumber != _trackNumber + 1) {
+		//The console hasn't switched to the requested track yet
+		_skippedSamples += sampleCount;
+		if(_skippedSamples > AudioTrackRenderer::MaxTrackSwitchDelay * sampleRate) {
+			Finish(false);
+		}
+		return;
+	}
+
+	if((!_waveRecorder && !_pcmStream.is_open()) || info.Position < _lastPosition) {
+		//Some consoles reset to start playing the selected track, restart from the beginning when this happens
+		OpenOutput();
+	}
+	_lastPosition = info.Position;
+
+	AudioConfig cfg = _emu->GetSettings()->GetAudioConfig();
+	double length = info.Length > 0 ? info.Length : AudioTrackRenderer::MaxTrackLength;
+	uint32_t trackEnd = (uint32_t)(length * sampleRate);
+	uint32_t fadeStart = info.FadeLength > 0 ? (uint32_t)(std::max(0.0, length - info.FadeLength) * sampleRate) : trackEnd;
+	uint32_t silenceLength = cfg.AudioPlayerAutoDetectSilence ? cfg.AudioPlayerSilenceDelay * sampleRate : 0;
+
+	_outputBuffer.clear();
+	for(uint32_t i = 0; i < sampleCount; i++) {
+		if(_sampleCount >= trackEnd) {
+			WriteSamples(_outputBuffer.data(), (uint32_t)_outputBuffer.size() / 2, sampleRate);
+			Finish(true);
+			return;
+		}
+
+		int16_t left = samples[i * 2];
+		int16_t right = samples[i * 2 + 1];
+		if(_sampleCount >= fadeStart) {
+			double ratio = (double)(trackEnd - _sampleCount) / (trackEnd - fadeStart);
+			left = (int16_t)(left * ratio);
+			right = (int16_t)(right * ratio);
+		}
+		_sampleCount++;
+
+		if(silenceLength > 0) {
+			if(_pendingSilence.empty()) {
+				_silenceLeft = left;
+				_silenceRight = right;
+			}
+
+			if(std::abs(left - _silenceLeft) <= AudioTrackRenderer::SilenceThreshold && std::abs(right - _silenceRight) <= AudioTrackRenderer::SilenceThreshold) {
+				//Keep silent samples aside until the silence ends - trailing silence is not written to the output
+				_pendingSilence.push_back(left);
+				_pendingSilence.push_back(right);
+				if(_pendingSilence.size() / 2 >= silenceLength) {
+					WriteSamples(_outputBuffer.data(), (uint32_t)_outputBuffer.size() / 2, sampleRate);
+					Finish(true);
+					return;
+				}
+				continue;
+			}
+
+			_outputBuffer.insert(_outputBuffer.end(), _pendingSilence.begin(), _pendingSilence.end());
+			_pendingSilence.clear();
+		}
+
+		_outputBuffer.push_back(left);
+		_outputBuffer.push_back(right);
+	}
+
+	WriteSamples(_outputBuffer.data(), (uint32_t)_outputBuffer.size() / 2, sampleRate);
+}
+
+bool AudioTrackRenderer::WaitForCompletion(Emulator* emu)
+{
+	while(!_doneSignal.Wait(100)) {
+		if(!emu->IsRunning()) {
+			//Emulation stopped before the end of the track
+			Finish(false);
+		}
+	}
+	return _success;
+}
+
+unique_ptr<Emulator> AudioTrackRenderer::CreateEmulator(EmuSettings* settings)
+{
+	unique_ptr<Emulator> emu(new Emulator());
+	emu->Initialize(false);
+
+	EmuSettings* emuSettings = emu->GetSettings();
+	emuSettings->SetFlag(EmulationFlags::ConsoleMode);
+	emuSettings->SetFlag(EmulationFlags::AudioOnly);
+
+	AudioConfig audioCfg = settings->GetAudioConfig();
+	audioCfg.DisableDynamicSampleRate = true;
+	emuSettings->SetAudioConfig(audioCfg);
+	emuSettings->SetNesConfig(settings->GetNesConfig());
+	emuSettings->SetSnesConfig(settings->GetSnesConfig());
+	emuSettings->SetGameboyConfig(settings->GetGameboyConfig());
+	emuSettings->SetPcEngineConfig(settings->GetPcEngineConfig());
+	emuSettings->GetPreferences().RewindBufferSize = 0;
+	return emu;
+}
+
+bool AudioTrackRenderer::RenderTrack(EmuSettings* settings, string romFile, string outputFile, uint32_t trackNumber, bool rawPcm)
+{
+	unique_ptr<Emulator> emu = CreateEmulator(settings);
+
+	bool result = false;
+	emu->Lock();
+	if(emu->LoadRom((VirtualFile)romFile, VirtualFile())) {
+		AudioTrackInfo info = emu->GetAudioTrackInfo();
+		bool selectTrack = emu->GetRomInfo().Format != RomFormat::Spc && info.TrackNumber != trackNumber + 1;
+
+		AudioTrackRenderer renderer(emu.get(), outputFile, trackNumber, selectTrack, rawPcm);
+		emu->GetSoundMixer()->SetTrackRenderer(&renderer);
+		if(selectTrack) {
+			AudioPlayerActionParams params = {};
+			params.Action = AudioPlayerAction::SelectTrack;
+			params.TrackNumber = trackNumber;
+			emu->ProcessAudioPlayerAction(params);
+		}
+		emu->GetSettings()->SetFlag(EmulationFlags::MaximumSpeed);
+		emu->Unlock();
+
+		result = renderer.WaitForCompletion(emu.get());
+
+		emu->Stop(false);
+		emu->GetSoundMixer()->SetTrackRenderer(nullptr);
+	} else {
+		emu->Unlock();
+	}
+
+	emu->Release();
+	return result;
+}
+
+int32_t AudioTrackRenderer::RenderTracks(EmuSettings* settings, string romFile, string outputFolder, uint32_t threadCount, bool rawPcm)
+{
+	uint32_t trackCount = 0;
+	{
+		//Load the file once to validate it and get the number of tracks it contains
+		unique_ptr<Emulator> emu = CreateEmulator(settings);
+		emu->Lock();
+		if(emu->LoadRom((VirtualFile)romFile, VirtualFile())) {
+			RomFormat format = emu->GetRomInfo().Format;
+			if(format == RomFormat::Spc) {
+				//Each SPC file contains a single track
+				trackCount = 1;
+			} else if(format == RomFormat::Nsf || format == RomFormat::Gbs || format == RomFormat::PceHes) {
+				trackCount = emu->GetAudioTrackInfo().TrackCount;
+			}
+		}
+		emu->Unlock();
+		emu->Stop(false);
+		emu->Release();
+	}
+
+	if(trackCount == 0) {
+		return -1;
+	}
+
+	FolderUtilities::CreateFolder(outputFolder);
+	string baseName = FolderUtilities::GetFilename(romFile, false);
+	string extension = rawPcm ? ".pcm" : ".wav";
+
+	threadCount = std::max<uint32_t>(1, std::min(threadCount, trackCount));
+	atomic<uint32_t> nextTrack(0);
+	atomic<int32_t> renderedCount(0);
+
+	auto renderTracks = [&]() {
+		uint32_t track;
+		while((track = nextTrack++) < trackCount) {
+			string trackNumber = std::to_string(track + 1);
+			if(trackNumber.size() < 2) {
+				trackNumber = "0" + trackNumber;
+			}
+
+			string outputFile = trackCount > 1 ? (baseName + " - " + trackNumber + extension) : (baseName + extension);
+			if(RenderTrack(settings, romFile, FolderUtilities::CombinePath(outputFolder, outputFile), track, rawPcm)) {
+				renderedCount++;
+			}
+		}
+	};
+
+	vector<unique_ptr<thread>> threads;
+	for(uint32_t i = 1; i < threadCount; i++) {
+		threads.push_back(unique_ptr<thread>(new thread(renderTracks)));
+	}
+	renderTracks();
+
+	for(unique_ptr<thread>& t : threads) {
+		t->join();
+	}
+
+	return renderedCount;
+}
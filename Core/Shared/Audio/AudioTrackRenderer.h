@@ -0,0 +1,64 @@
+#pragma once
+#include "pch.h"
+#include "Utilities/AutoResetEvent.h"
+
+class Emulator;
+class EmuSettings;
+class WaveRecorder;
+
+//Renders the tracks of NSF/SPC/GBS/HES files to WAV (or raw PCM) files as fast as possible.
+//Each track is played by its own background Emulator instance (with video output disabled),
+//so multiple tracks can be rendered in parallel.
+class AudioTrackRenderer
+{
+private:
+	//Used when the track has no length and silence detection doesn't end it
+	static constexpr uint32_t MaxTrackLength = 15 * 60;
+
+	//Give up if the console takes longer than this (in seconds of audio) to switch to the requested track
+	static constexpr uint32_t MaxTrackSwitchDelay = 10;
+
+	//Samples within this range of the first sample of a silent block are considered silent
+	static constexpr int16_t SilenceThreshold = 64;
+
+	Emulator* _emu = nullptr;
+	string _outputFile;
+	uint32_t _trackNumber = 0;
+	bool _checkTrackNumber = false;
+	bool _rawPcm = false;
+
+	unique_ptr<WaveRecorder> _waveRecorder;
+	ofstream _pcmStream;
+	vector<int16_t> _outputBuffer;
+	vector<int16_t> _pendingSilence;
+
+	uint32_t _sampleCount = 0;
+	uint32_t _skippedSamples = 0;
+	double _lastPosition = 0;
+	int16_t _silenceLeft = 0;
+	int16_t _silenceRight = 0;
+
+	atomic<bool> _done;
+	bool _success = false;
+	AutoResetEvent _doneSignal;
+
+	AudioTrackRenderer(Emulator* emu, string outputFile, uint32_t trackNumber, bool checkTrackNumber, bool rawPcm);
+
+	void OpenOutput();
+	void CloseOutput();
+	void WriteSamples(int16_t* samples, uint32_t sampleCount, uint32_t sampleRate);
+	void Finish(bool success);
+	bool WaitForCompletion(Emulator* emu);
+
+	static unique_ptr<Emulator> CreateEmulator(EmuSettings* settings);
+	static bool RenderTrack(EmuSettings* settings, string romFile, string outputFile, uint32_t trackNumber, bool rawPcm);
+
+public:
+	~AudioTrackRenderer();
+
+	//Called by the SoundMixer (on the emulation thread) with the final output samples
+	void ProcessSamples(int16_t* samples, uint32_t sampleCount, uint32_t sampleRate);
+
+	//Renders all tracks in the file to the output folder, returns the number of tracks rendered, or -1 on error
+	static int32_t RenderTracks(EmuSettings* settings, string romFile, string outputFolder, uint32_t threadCount, bool rawPcm);
+};
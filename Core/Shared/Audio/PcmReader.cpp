@@ -6,53 +6,101 @@
 PcmReader::PcmReader()
 {
 	_done = true;
+	_loop = false;
 	_loopOffset = 8;
 	_outputBuffer = new int16_t[20000];
+
+	_buffer.resize(BufferSize);
+	_bufferHead = 0;
+	_bufferTail = 0;
+	_endOfFile = true;
+	_stopThread = false;
 }
 
 PcmReader::~PcmReader()
 {
+	StopThread();
 	delete[] _outputBuffer;
 }
 
+void PcmReader::StopThread()
+{
+	if(_thread.joinable()) {
+		_stopThread = true;
+		_threadSignal.Signal();
+		_thread.join();
+	}
+}
+
+void PcmReader::PrefetchThread()
+{
+	while(!_stopThread) {
+		_threadSignal.Wait();
+
+		//Read the file one chunk at a time, to allow the emulation thread to take the lock between chunks
+		while(!_stopThread) {
+			auto lock = _fileLock.AcquireSafe();
+			uint32_t freeSpace = BufferSize - (_bufferHead - _bufferTail);
+			if(_endOfFile || !_file.is_open() || freeSpace < ChunkSize) {
+				break;
+			}
+			FillBuffer(ChunkSize);
+		}
+	}
+}
+
 bool PcmReader::Init(string filename, bool loop, uint32_t startOffset)
 {
-	if(_file) {
+	auto lock = _fileLock.AcquireSafe();
+
+	if(_file.is_open()) {
 		_file.close();
 	}
+	_file.clear();
 
 	_file.open(filename, ios::binary);
-	if(_file) {
-		_file.seekg(0, ios::end);
-		_fileSize = (uint32_t)_file.tellg();
-		if(_fileSize < 12) {
-			return false;
-		}
+	if(!_file) {
+		_done = true;
+		return false;
+	}
 
-		_file.seekg(4, ios::beg);
-		uint32_t loopOffset = (uint8_t)_file.get();
-		loopOffset |= ((uint8_t)_file.get()) << 8;
-		loopOffset |= ((uint8_t)_file.get()) << 16;
-		loopOffset |= ((uint8_t)_file.get()) << 24;
+	_file.seekg(0, ios::end);
+	_fileSize = (uint32_t)_file.tellg();
+	if(_fileSize < 12) {
+		_file.close();
+		_done = true;
+		return false;
+	}
 
-		_loopOffset = (uint32_t)loopOffset;
+	uint8_t header[8] = {};
+	_file.seekg(0, ios::beg);
+	_file.read((char*)header, sizeof(header));
+	_loopOffset = header[4] | (header[5] << 8) | (header[6] << 16) | (header[7] << 24);
 
-		_prevLeft = 0;
-		_prevRight = 0;
-		_done = false;
-		_loop = loop;
-		_fileOffset = startOffset;
-		_file.seekg(_fileOffset, ios::beg);
+	_done = false;
+	_loop = loop;
+	_fileOffset = startOffset;
+	_readOffset = startOffset;
+	_file.seekg(_readOffset, ios::beg);
 
-		_leftoverSampleCount = 0;
-		_pcmBuffer.clear();
-		_resampler.Reset();
+	_bufferHead = 0;
+	_bufferTail = 0;
+	_endOfFile = false;
 
-		return true;
-	} else {
-		_done = true;
-		return false;
+	_pcmBuffer.clear();
+	_resampler.Reset();
+
+	//Read the start of the track immediately, the prefetch thread reads the rest
+	FillBuffer(PrebufferSize);
+	lock.Release();
+
+	if(!_thread.joinable()) {
+		_stopThread = false;
+		_thread = std::thread(&PcmReader::PrefetchThread, this);
 	}
+	_threadSignal.Signal();
+
+	return true;
 }
 
 bool PcmReader::IsPlaybackOver()
@@ -74,45 +122,98 @@ void PcmReader::SetLoopFlag(bool loop)
 	_loop = loop;
 }
 
-void PcmReader::ReadSample(int16_t &left, int16_t &right)
+uint32_t PcmReader::GetLoopStart()
 {
-	uint8_t val[4];
-	_file.get(((char*)val)[0]);
-	_file.get(((char*)val)[1]);
-	_file.get(((char*)val)[2]);
-	_file.get(((char*)val)[3]);
-
-	left = val[0] | (val[1] << 8);
-	right = val[2] | (val[3] << 8);
+	return _loopOffset * 4 + 8;
 }
 
-void PcmReader::LoadSamples(uint32_t samplesToLoad)
+void PcmReader::FillBuffer(uint32_t maxSamples)
 {
-	uint32_t samplesRead = 0;
+	//Must be called while holding _fileLock
+	uint32_t head = _bufferHead.load(std::memory_order_relaxed);
+	uint32_t count = std::min(maxSamples, BufferSize - (head - _bufferTail.load(std::memory_order_acquire)));
+
+	while(count > 0 && !_endOfFile) {
+		if(_readOffset + 4 > _fileSize) {
+			//Reached the end of the file - if the loop flag is turned off/on after this point, the
+			//emulation thread will discard the looped samples, or read them itself, as needed
+			uint32_t loopStart = GetLoopStart();
+			if(_loop && loopStart + 4 <= _fileSize) {
+				_readOffset = loopStart;
+				_file.seekg(_readOffset, ios::beg);
+			} else {
+				_endOfFile = true;
+				break;
+			}
+		}
+
+		uint32_t samplesToRead = std::min({ count, (_fileSize - _readOffset) / 4, ChunkSize });
+		_file.read((char*)_readBuffer, samplesToRead * 4);
+		if(!_file) {
+			_file.clear();
+			_endOfFile = true;
+			break;
+		}
 
+		for(uint32_t i = 0; i < samplesToRead; i++) {
+			PcmSample& sample = _buffer[(head + i) & BufferMask];
+			uint8_t* data = _readBuffer + i * 4;
+			sample.Left = (int16_t)(data[0] | (data[1] << 8));
+			sample.Right = (int16_t)(data[2] | (data[3] << 8));
+			sample.Offset = _readOffset + i * 4;
+		}
+
+		head += samplesToRead;
+		_bufferHead.store(head, std::memory_order_release);
+		_readOffset += samplesToRead * 4;
+		count -= samplesToRead;
+	}
+}
+
+bool PcmReader::ReadSample(int16_t &left, int16_t &right)
+{
+	bool endOfTrack = _fileOffset + 4 > _fileSize;
+	if(endOfTrack && !_loop) {
+		return false;
+	}
+
+	uint32_t tail = _bufferTail.load(std::memory_order_relaxed);
+	if(tail == _bufferHead.load(std::memory_order_acquire)) {
+		//The prefetch thread hasn't read this part of the file yet (or it stopped at the end of
+		//the file because the loop flag was off at the time), read the data on this thread
+		auto lock = _fileLock.AcquireSafe();
+		_endOfFile = false;
+		FillBuffer(ChunkSize);
+		if(tail == _bufferHead.load(std::memory_order_acquire)) {
+			return false;
+		}
+	}
+
+	PcmSample& sample = _buffer[tail & BufferMask];
+	left = sample.Left;
+	right = sample.Right;
+	_fileOffset = sample.Offset + 4;
+	_bufferTail.store(tail + 1, std::memory_order_release);
+	return true;
+}
+
+void PcmReader::LoadSamples(uint32_t samplesToLoad)
+{
 	int16_t left = 0;
 	int16_t right = 0;
-	for(uint32_t i = _fileOffset; i < _fileSize && samplesRead < samplesToLoad; i+=4) {
-		ReadSample(left, right);
+	for(uint32_t i = 0; i < samplesToLoad; i++) {
+		if(!ReadSample(left, right)) {
+			_done = true;
+			break;
+		}
 
 		_pcmBuffer.push_back(left);
 		_pcmBuffer.push_back(right);
+	}
 
-		_prevLeft = left;
-		_prevRight = right;
-
-		_fileOffset += 4;
-		samplesRead++;
-
-		if(samplesRead < samplesToLoad && i + 4 >= _fileSize) {
-			if(_loop) {
-				i = _loopOffset * 4 + 8;
-				_fileOffset = i;
-				_file.seekg(_fileOffset, ios::beg);
-			} else {
-				_done = true;
-			}
-		}
+	if(!_done && !_endOfFile && BufferSize - (_bufferHead - _bufferTail) >= BufferSize / 2) {
+		//Wake up the prefetch thread once half of the buffer has been played
+		_threadSignal.Signal();
 	}
 }
 
@@ -140,4 +241,4 @@ void PcmReader::ApplySamples(int16_t *buffer, size_t sampleCount, uint8_t volume
 uint32_t PcmReader::GetOffset()
 {
 	return _fileOffset;
-}
\ No newline at end of file
+}
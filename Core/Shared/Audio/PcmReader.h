@@ -2,34 +2,67 @@
 #include "pch.h"
 #include "Utilities/Audio/stb_vorbis.h"
 #include "Utilities/Audio/HermiteResampler.h"
+#include "Utilities/SimpleLock.h"
+#include "Utilities/AutoResetEvent.h"
+#include <thread>
 
 class PcmReader
 {
 private:
 	static constexpr int PcmSampleRate = 44100;
-	static constexpr int SamplesToRead = 100;
+
+	//Number of samples the prefetch buffer can contain (~1.5 seconds)
+	static constexpr uint32_t BufferSize = 0x10000;
+	static constexpr uint32_t BufferMask = BufferSize - 1;
+	//Max number of samples read from the file at once
+	static constexpr uint32_t ChunkSize = 0x1000;
+	//Number of samples read immediately when a track is loaded
+	static constexpr uint32_t PrebufferSize = 0x2000;
+
+	struct PcmSample
+	{
+		int16_t Left;
+		int16_t Right;
+		uint32_t Offset; //File offset of this sample
+	};
 
 	int16_t* _outputBuffer = nullptr;
 
+	//The file is read ahead of time by a background thread into a ring buffer (single producer, single consumer).
+	//Reading from the file is done while holding _fileLock - when the prefetch thread falls behind, the
+	//emulation thread reads the data it needs itself, so the samples played never depend on the thread's timing.
 	ifstream _file;
-	uint32_t _fileOffset = 0;
 	uint32_t _fileSize = 0;
 	uint32_t _loopOffset = 0;
+	uint32_t _readOffset = 0; //Next file offset to read into the buffer
+	atomic<bool> _endOfFile;
 
-	int16_t _prevLeft = 0;
-	int16_t _prevRight = 0;
+	vector<PcmSample> _buffer;
+	atomic<uint32_t> _bufferHead;
+	atomic<uint32_t> _bufferTail;
+	uint8_t _readBuffer[ChunkSize * 4] = {};
 
-	bool _loop = false;
+	std::thread _thread;
+	atomic<bool> _stopThread;
+	AutoResetEvent _threadSignal;
+	SimpleLock _fileLock;
+
+	uint32_t _fileOffset = 0; //File offset of the next sample to play
+	atomic<bool> _loop;
 	bool _done = false;
 
 	HermiteResampler _resampler;
 	vector<int16_t> _pcmBuffer;
-	uint32_t _leftoverSampleCount = 0;
 
 	uint32_t _sampleRate = 0;
 
+	uint32_t GetLoopStart();
+	void FillBuffer(uint32_t maxSamples);
+	void PrefetchThread();
+	void StopThread();
+
 	void LoadSamples(uint32_t samplesToLoad);
-	void ReadSample(int16_t &left, int16_t &right);
+	bool ReadSample(int16_t &left, int16_t &right);
 
 public:
 	PcmReader();
@@ -7,6 +7,8 @@
 #include "Shared/RewindManager.h"
 #include "Shared/Video/VideoRenderer.h"
 #include "Shared/Audio/WaveRecorder.h"
+#include "Shared/Audio/AudioTrackRenderer.h"
+#include "Shared/PerformanceCounters.h"
 #include "Shared/Interfaces/IAudioProvider.h"
 #include "Utilities/Audio/Equalizer.h"
 #include "Utilities/Audio/ReverbFilter.h"
@@ -19,7 +21,6 @@ SoundMixer::SoundMixer(Emulator* emu)
 	_resampler.reset(new SoundResampler(emu));
 	_sampleBuffer = new int16_t[0x10000];
 	_reverbFilter.reset(new ReverbFilter());
-	_crossFeedFilter.reset(new CrossFeedFilter());
 }
 
 SoundMixer::~SoundMixer()
@@ -70,7 +71,7 @@ void SoundMixer::PlayAudioBuffer(int16_t* samples, uint32_t sampleCount, uint32_
 	}
 
 	EmuSettings* settings = _emu->GetSettings();
-	AudioPlayerHud* audioPlayer = _emu->GetAudioPlayerHud();
+	AudioPlayerHud* audioPlayer = _trackRenderer ? nullptr : _emu->GetAudioPlayerHud();
 	AudioConfig cfg = settings->GetAudioConfig();
 	bool isRecording = _waveRecorder || _emu->GetVideoRenderer()->IsRecording();
 
@@ -90,8 +91,12 @@ void SoundMixer::PlayAudioBuffer(int16_t* samples, uint32_t sampleCount, uint32_
 	_leftSample = samples[0];
 	_rightSample = samples[1];
 
+	PerformanceCounters* perfCounters = _emu->GetPerformanceCounters();
+	uint64_t startTime = PerformanceCounters::GetTimestamp();
+
+	//The resampler overwrites the first "count" samples of the buffer and the providers add to them,
+	//so the buffer doesn't need to be cleared beforehand
 	int16_t *out = _sampleBuffer;
-	memset(_sampleBuffer, 0, 0x10000 * 2);
 	uint32_t count = _resampler->Resample(samples, sampleCount, sourceRate, cfg.SampleRate, out, 0x10000);
 
 	uint32_t targetRate = (uint32_t)(cfg.SampleRate * _resampler->GetRateAdjustment());
@@ -99,8 +104,11 @@ void SoundMixer::PlayAudioBuffer(int16_t* samples, uint32_t sampleCount, uint32_
 		provider->MixAudio(out, count, targetRate);
 	}
 
+	perfCounters->AddSample(PerfStage::AudioMixing, startTime);
+	startTime = PerformanceCounters::GetTimestamp();
+
 	if(cfg.EnableEqualizer) {
-		ProcessEqualizer(out, count, targetRate);
+		ProcessEqualizer(cfg, out, count);
 	}
 
 	if(audioPlayer) {
@@ -115,15 +123,18 @@ void SoundMixer::PlayAudioBuffer(int16_t* samples, uint32_t sampleCount, uint32_
 		}
 	}
 
-	if(cfg.CrossFeedEnabled) {
-		_crossFeedFilter->ApplyFilter(out, count, cfg.CrossFeedRatio);
+	uint32_t crossFeedRatio = cfg.CrossFeedEnabled ? cfg.CrossFeedRatio : 0;
+	if(crossFeedRatio > 0 || masterVolume < 100) {
+		//Apply cross feed and volume (if not using the default values)
+		CrossFeedFilter::ApplyFilter(out, count, crossFeedRatio, masterVolume);
 	}
 
-	if(masterVolume < 100) {
-		//Apply volume if not using the default value
-		for(uint32_t i = 0; i < count * 2; i++) {
-			out[i] = (int32_t)out[i] * (int32_t)masterVolume / 100;
-		}
+	perfCounters->AddSample(PerfStage::AudioEffects, startTime);
+
+	if(_trackRenderer) {
+		//Rendering audio to a file, the audio player's track length/silence detection logic is handled by the renderer
+		_trackRenderer->ProcessSamples(out, count, cfg.SampleRate);
+		return;
 	}
 
 	RewindManager* rewindManager = _emu->GetRewindManager();
@@ -142,6 +153,7 @@ void SoundMixer::PlayAudioBuffer(int16_t* samples, uint32_t sampleCount, uint32_
 		//(this is to prevent playing an audio blip when loading a save state)
 		if(!_emu->IsPaused() && _audioDevice) {
 			if(cfg.EnableAudio) {
+				PerfTimer timer(perfCounters, PerfStage::AudioOutput);
 				_audioDevice->PlayBuffer(out, count, cfg.SampleRate, true);
 				_audioDevice->ProcessEndOfFrame();
 			} else {
@@ -151,19 +163,19 @@ void SoundMixer::PlayAudioBuffer(int16_t* samples, uint32_t sampleCount, uint32_
 	}
 }
 
-void SoundMixer::ProcessEqualizer(int16_t* samples, uint32_t sampleCount, uint32_t targetRate)
+void SoundMixer::ProcessEqualizer(AudioConfig& cfg, int16_t* samples, uint32_t sampleCount)
 {
-	AudioConfig cfg = _emu->GetSettings()->GetAudioConfig();
 	if(!_equalizer) {
 		_equalizer.reset(new Equalizer());
 	}
-	vector<double> bandGains = {
+	std::array<double, Equalizer::BandCount> bandGains = {
 		cfg.Band1Gain, cfg.Band2Gain, cfg.Band3Gain, cfg.Band4Gain, cfg.Band5Gain,
 		cfg.Band6Gain, cfg.Band7Gain, cfg.Band8Gain, cfg.Band9Gain, cfg.Band10Gain,
 		cfg.Band11Gain, cfg.Band12Gain, cfg.Band13Gain, cfg.Band14Gain, cfg.Band15Gain,
 		cfg.Band16Gain, cfg.Band17Gain, cfg.Band18Gain, cfg.Band19Gain, cfg.Band20Gain
 	};
-	
+
+	//Filters are only recalculated when the gains or sample rate change
 	_equalizer->UpdateEqualizers(bandGains, cfg.SampleRate);
 	_equalizer->ApplyEqualizer(sampleCount, samples);
 }
@@ -188,6 +200,11 @@ bool SoundMixer::IsRecording()
 	return _waveRecorder != nullptr;
 }
 
+void SoundMixer::SetTrackRenderer(AudioTrackRenderer* renderer)
+{
+	_trackRenderer = renderer;
+}
+
 void SoundMixer::GetLastSamples(int16_t &left, int16_t &right)
 {
 	left = _leftSample;
@@ -8,8 +8,9 @@ class Equalizer;
 class SoundResampler;
 class WaveRecorder;
 class IAudioProvider;
-class CrossFeedFilter;
 class ReverbFilter;
+class AudioTrackRenderer;
+struct AudioConfig;
 
 class SoundMixer 
 {
@@ -20,15 +21,15 @@ private:
 	unique_ptr<Equalizer> _equalizer;
 	unique_ptr<SoundResampler> _resampler;
 	safe_ptr<WaveRecorder> _waveRecorder;
+	AudioTrackRenderer* _trackRenderer = nullptr;
 	int16_t *_sampleBuffer = nullptr;
 
 	int16_t _leftSample = 0;
 	int16_t _rightSample = 0;
 
-	unique_ptr<CrossFeedFilter> _crossFeedFilter;
 	unique_ptr<ReverbFilter> _reverbFilter;
 
-	void ProcessEqualizer(int16_t *samples, uint32_t sampleCount, uint32_t targetRate);
+	void ProcessEqualizer(AudioConfig& cfg, int16_t *samples, uint32_t sampleCount);
 
 public:
 	SoundMixer(Emulator *emu);
@@ -48,5 +49,6 @@ public:
 	void StartRecording(string filepath);
 	void StopRecording();
 	bool IsRecording();
+	void SetTrackRenderer(AudioTrackRenderer* renderer);
 	void GetLastSamples(int16_t &left, int16_t &right);
 };
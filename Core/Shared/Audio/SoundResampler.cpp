@@ -5,6 +5,7 @@
 #include "Shared/Audio/SoundResampler.h"
 #include "Shared/Video/VideoRenderer.h"
 #include "Utilities/Audio/HermiteResampler.h"
+#include "Utilities/Audio/SincResampler.h"
 
 SoundResampler::SoundResampler(Emulator* emu)
 {
@@ -36,40 +37,26 @@ double SoundResampler::GetTargetRateAdjustment()
 		AudioStatistics stats = _emu->GetSoundMixer()->GetStatistics();
 
 		if(stats.AverageLatency > 0 && _emu->GetSettings()->GetEmulationSpeed() == 100) {
-			//Try to stay within +/- 3ms of requested latency
-			constexpr int32_t maxGap = 3;
-			constexpr int32_t maxSubAdjustment = 3600;
+			//PI controller on the audio buffer's fill level (in ms of latency):
+			//-The proportional term corrects the current gap between the actual and requested latency
+			//-The integral term slowly converges towards the actual output rate of the sound card
+			constexpr double proportionalGain = 0.0004;
+			constexpr double integralGain = 0.000004;
+			constexpr double maxIntegral = 0.003;
+			constexpr double maxAdjustment = 0.005;
 
-			int32_t requestedLatency = (int32_t)cfg.AudioLatency;
-			double latencyGap = stats.AverageLatency - requestedLatency;
-			double adjustment = std::min(0.0025, (std::ceil((std::abs(latencyGap) - maxGap) * 8)) * 0.00003125);
+			double latencyGap = stats.AverageLatency - (double)cfg.AudioLatency;
+			_rateIntegral = std::clamp(_rateIntegral + latencyGap * integralGain, -maxIntegral, maxIntegral);
 
-			if(latencyGap < 0 && _underTarget < maxSubAdjustment) {
-				_underTarget++;
-			} else if(latencyGap > 0 && _underTarget > -maxSubAdjustment) {
-				_underTarget--;
-			}
-
-			//For every ~1 second spent under/over target latency, further adjust rate (GetTargetRate is called approx. 3x per frame) 
-			//This should slowly get us closer to the actual output rate of the sound card
-			double subAdjustment = 0.00003125 * _underTarget / 180;
-
-			if(adjustment > 0) {
-				if(latencyGap > maxGap) {
-					_rateAdjustment = 1 - adjustment + subAdjustment;
-				} else if(latencyGap < -maxGap) {
-					_rateAdjustment = 1 + adjustment + subAdjustment;
-				}
-			} else if(std::abs(latencyGap) < 1) {
-				//Restore normal rate once we get within +/- 1ms
-				_rateAdjustment = 1.0 + subAdjustment;
-			}
+			//Latency above target = too many samples buffered, lower the output rate (and vice versa)
+			double adjustment = std::clamp(latencyGap * proportionalGain + _rateIntegral, -maxAdjustment, maxAdjustment);
+			_rateAdjustment = 1.0 - adjustment;
 		} else {
-			_underTarget = 0;
+			_rateIntegral = 0;
 			_rateAdjustment = 1.0;
 		}
 	} else {
-		_underTarget = 0;
+		_rateIntegral = 0;
 		_rateAdjustment = 1.0;
 	}
 	return _rateAdjustment;
@@ -91,11 +78,24 @@ void SoundResampler::UpdateTargetSampleRate(uint32_t sourceRate, uint32_t sample
 		_previousTargetRate = targetRate;
 		_prevInputRate = inputRate;
 		_resampler.SetSampleRates(inputRate, targetRate);
+		_sincResampler.SetSampleRates(inputRate, targetRate);
 	}
 }
 
 uint32_t SoundResampler::Resample(int16_t *inSamples, uint32_t sampleCount, uint32_t sourceRate, uint32_t sampleRate, int16_t *outSamples, uint32_t maxOutCount)
 {
+	AudioResamplingQuality quality = _emu->GetSettings()->GetAudioConfig().ResamplingQuality;
+	if(quality != _quality) {
+		_quality = quality;
+		_resampler.Reset();
+		_sincResampler.SetTapCount(quality == AudioResamplingQuality::High ? 32 : 16);
+		_sincResampler.Reset();
+	}
+
 	UpdateTargetSampleRate(sourceRate, sampleRate);
-	return _resampler.Resample<false>(inSamples, sampleCount, outSamples, maxOutCount);
+	if(_quality == AudioResamplingQuality::Hermite) {
+		return _resampler.Resample<false>(inSamples, sampleCount, outSamples, maxOutCount);
+	} else {
+		return _sincResampler.Resample<false>(inSamples, sampleCount, outSamples, maxOutCount);
+	}
 }
\ No newline at end of file
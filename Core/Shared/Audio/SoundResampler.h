@@ -1,6 +1,8 @@
 #pragma once
 #include "pch.h"
 #include "Utilities/Audio/HermiteResampler.h"
+#include "Utilities/Audio/SincResampler.h"
+#include "Shared/SettingTypes.h"
 
 class Emulator;
 
@@ -12,9 +14,11 @@ private:
 	double _rateAdjustment = 1.0;
 	double _previousTargetRate = 0;
 	double _prevInputRate = 0;
-	int32_t _underTarget = 0;
+	double _rateIntegral = 0;
 
+	AudioResamplingQuality _quality = AudioResamplingQuality::Hermite;
 	HermiteResampler _resampler;
+	SincResampler _sincResampler;
 
 	double GetTargetRateAdjustment();
 	void UpdateTargetSampleRate(uint32_t sourceRate, uint32_t sampleRate);
@@ -8,6 +8,9 @@
 #include "Shared/Interfaces/IInputProvider.h"
 #include "Shared/Interfaces/IInputRecorder.h"
 #include "Shared/SystemActionManager.h"
+#include "Shared/Movies/MovieManager.h"
+#include "Netplay/GameClient.h"
+#include "Netplay/GameServer.h"
 #include "Shared/EventType.h"
 #include "Shared/MessageManager.h"
 #include "Utilities/Serializer.h"
@@ -138,6 +141,7 @@ vector<shared_ptr<BaseControlDevice>> BaseControlManager::GetControlDevices()
 void BaseControlManager::Serialize(Serializer& s)
 {
 	SV(_pollCounter);
+	SV(_pendingInputUpdate);
 }
 
 void BaseControlManager::RegisterControlDevice(shared_ptr<BaseControlDevice> controlDevice)
@@ -157,6 +161,9 @@ void BaseControlManager::ClearDevices()
 
 void BaseControlManager::UpdateInputState()
 {
+	//Any pending just-in-time poll is replaced by this one
+	_pendingInputUpdate = false;
+
 	KeyManager::RefreshKeyState();
 
 	auto lock = _deviceLock.AcquireSafe();
@@ -190,6 +197,29 @@ void BaseControlManager::UpdateInputState()
 	_pollCounter++;
 }
 
+bool BaseControlManager::IsJustInTimePollingAllowed()
+{
+	if(!_emu->GetSettings()->GetEmulationConfig().JustInTimeInputPolling) {
+		return false;
+	}
+
+	//Movies and netplay expect the input to be polled at the same point in every frame
+	MovieManager* movies = _emu->GetMovieManager();
+	return !movies->Playing() && !movies->Recording() && !_emu->GetGameClient()->Connected() && !_emu->GetGameServer()->Started();
+}
+
+void BaseControlManager::RequestInputUpdate()
+{
+	//If the game didn't access its controllers during the last frame, run its poll now to keep exactly 1 poll per frame
+	ProcessPendingInputUpdate();
+
+	if(IsJustInTimePollingAllowed()) {
+		_pendingInputUpdate = true;
+	} else {
+		UpdateInputState();
+	}
+}
+
 void BaseControlManager::ProcessEndOfFrame()
 {
 	if(!_wasInputRead) {
@@ -27,6 +27,9 @@ protected:
 	uint32_t _pollCounter = 0;
 	uint32_t _lagCounter = 0;
 	bool _wasInputRead = false;
+	bool _pendingInputUpdate = false;
+
+	bool IsJustInTimePollingAllowed();
 
 	void RegisterControlDevice(shared_ptr<BaseControlDevice> controlDevice);
 
@@ -43,6 +46,18 @@ public:
 	virtual void UpdateControlDevices() {}
 	virtual void UpdateInputState();
 
+	//Called once per frame at a fixed point - when just-in-time polling is enabled, the input poll
+	//is delayed until the game first accesses its controllers (see ProcessPendingInputUpdate)
+	void RequestInputUpdate();
+
+	__forceinline void ProcessPendingInputUpdate()
+	{
+		if(_pendingInputUpdate) {
+			_pendingInputUpdate = false;
+			UpdateInputState();
+		}
+	}
+
 	void ProcessEndOfFrame();
 
 	void SetInputReadFlag();
@@ -24,8 +24,10 @@
 #include "Shared/Movies/MovieManager.h"
 #include "Shared/TimingInfo.h"
 #include "Shared/HistoryViewer.h"
+#include "Shared/PerformanceCounters.h"
 #include "Netplay/GameServer.h"
 #include "Netplay/GameClient.h"
+#include "Netplay/SpectatorRelay.h"
 #include "Shared/Interfaces/IConsole.h"
 #include "Shared/Interfaces/IBarcodeReader.h"
 #include "Shared/Interfaces/ITapeRecorder.h"
@@ -62,8 +64,10 @@ Emulator::Emulator() :
 	_cheatManager(new CheatManager(this)),
 	_movieManager(new MovieManager(this)),
 	_historyViewer(new HistoryViewer(this)),
+	_perfCounters(new PerformanceCounters()),
 	_gameServer(new GameServer(this)),
 	_gameClient(new GameClient(this)),
+	_spectatorRelay(new SpectatorRelay(this)),
 	_rewindManager(new RewindManager(this))
 {
 	_paused = false;
@@ -101,6 +105,7 @@ void Emulator::Release()
 
 	_gameClient->Disconnect();
 	_gameServer->StopServer();
+	_spectatorRelay->StopRelay();
 
 	_videoDecoder->StopThread();
 	_videoRenderer->StopThread();
@@ -131,6 +136,7 @@ void Emulator::Run()
 	_stats.reset(new DebugStats());
 	_frameLimiter.reset(new FrameLimiter(_frameDelay));
 	_lastFrameTimer.Reset();
+	_frameStartTime = PerformanceCounters::GetTimestamp();
 
 	while(!_stopFlag) {
 		bool useRunAhead = _settings->GetEmulationConfig().RunAheadFrames > 0 && !_debugger && !_audioPlayerHud && !_rewindManager->IsRewinding() && _settings->GetEmulationSpeed() > 0 && _settings->GetEmulationSpeed() <= 100;
@@ -154,6 +160,9 @@ void Emulator::Run()
 
 		if(_paused && !_stopFlag && !_debugger) {
 			WaitForPauseEnd();
+
+			//Don't count the time spent paused as emulation time
+			_frameStartTime = PerformanceCounters::GetTimestamp();
 		}
 	}
 
@@ -250,6 +259,10 @@ void Emulator::OnBeforeSendFrame()
 void Emulator::ProcessEndOfFrame()
 {
 	if(!_isRunAheadFrame) {
+		_perfCounters->AddSample(PerfStage::Emulation, _frameStartTime);
+
+		uint64_t waitStart = PerformanceCounters::GetTimestamp();
+		_frameLimiter->SetAdaptiveDelay(_settings->GetEmulationConfig().AdaptiveFrameDelay);
 		_frameLimiter->ProcessFrame();
 		while(_frameLimiter->WaitForNextFrame()) {
 			if(_stopFlag || _frameDelay != GetFrameDelay() || _paused || _pauseOnNextFrame || _lockCounter > 0) {
@@ -257,6 +270,8 @@ void Emulator::ProcessEndOfFrame()
 				break;
 			}
 		}
+		_perfCounters->AddSample(PerfStage::FrameLimiter, waitStart);
+		_frameStartTime = PerformanceCounters::GetTimestamp();
 
 		double newFrameDelay = GetFrameDelay();
 		if(newFrameDelay != _frameDelay) {
@@ -26,6 +26,7 @@ class MovieManager;
 class HistoryViewer;
 class FrameLimiter;
 class DebugStats;
+class PerformanceCounters;
 class BaseControlManager;
 class VirtualFile;
 class BaseVideoFilter;
@@ -34,6 +35,7 @@ class SystemActionManager;
 class AudioPlayerHud;
 class GameServer;
 class GameClient;
+class SpectatorRelay;
 
 class IInputRecorder;
 class IInputProvider;
@@ -81,9 +83,11 @@ private:
 	const unique_ptr<CheatManager> _cheatManager;
 	const unique_ptr<MovieManager> _movieManager;
 	const unique_ptr<HistoryViewer> _historyViewer;
+	const unique_ptr<PerformanceCounters> _perfCounters;
 	
 	const shared_ptr<GameServer> _gameServer;
 	const shared_ptr<GameClient> _gameClient;
+	const unique_ptr<SpectatorRelay> _spectatorRelay;
 	const shared_ptr<RewindManager> _rewindManager;
 
 	thread::id _emulationThreadId;
@@ -112,6 +116,7 @@ private:
 	unique_ptr<DebugStats> _stats;
 	unique_ptr<FrameLimiter> _frameLimiter;
 	Timer _lastFrameTimer;
+	uint64_t _frameStartTime = 0;
 	double _frameDelay = 0;
 	
 	uint32_t _autoSaveStateFrameCounter = 0;
@@ -192,12 +197,14 @@ public:
 	RewindManager* GetRewindManager() { return _rewindManager.get(); }
 	DebugHud* GetDebugHud() { return _debugHud.get(); }
 	DebugHud* GetScriptHud() { return _scriptHud.get(); }
+	PerformanceCounters* GetPerformanceCounters() { return _perfCounters.get(); }
 	BatteryManager* GetBatteryManager() { return _batteryManager.get(); }
 	CheatManager* GetCheatManager() { return _cheatManager.get(); }
 	MovieManager* GetMovieManager() { return _movieManager.get(); }
 	HistoryViewer* GetHistoryViewer() { return _historyViewer.get(); }
 	GameServer* GetGameServer() { return _gameServer.get(); }
 	GameClient* GetGameClient() { return _gameClient.get(); }
+	SpectatorRelay* GetSpectatorRelay() { return _spectatorRelay.get(); }
 	shared_ptr<SystemActionManager> GetSystemActionManager() { return _systemActionManager; }
 
 	BaseVideoFilter* GetVideoFilter(bool getDefaultFilter = false);
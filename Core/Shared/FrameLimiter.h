@@ -4,11 +4,73 @@
 class FrameLimiter
 {
 private:
+	//Smoothing factor for the frame cost average/variance (roughly the last ~30 frames)
+	static constexpr double CostSmoothing = 1.0 / 32;
+	//Safety margin = fixed margin + N standard deviations of the frame cost + extra margin added after late frames
+	static constexpr double FixedMargin = 1.0;
+	static constexpr double DeviationCount = 3.0;
+	static constexpr double LateFramePenalty = 2.0;
+	static constexpr double MaxLatePenalty = 8.0;
+	static constexpr double PenaltyDecay = 0.02;
+	//Never delay the start of the frame by more than this fraction of the frame time
+	static constexpr double MaxStartDelayRatio = 0.8;
+
 	Timer _clockTimer;
 	double _targetTime;
 	double _delay;
 	bool _resetRunTimers;
 
+	bool _adaptiveDelay = false;
+	double _frameStart = -1;
+	double _startDelay = 0;
+	double _avgCost = 0;
+	double _costVariance = 0;
+	bool _hasCostEstimate = false;
+	double _latePenalty = 0;
+
+	void UpdateStartDelay(double now)
+	{
+		if(_frameStart >= 0) {
+			//The frame started after the previous wait ended and had to be done by the end of the current interval
+			double cost = std::min(now - _frameStart, _delay * 2);
+			bool isLate = now > _targetTime + _delay;
+
+			if(!_hasCostEstimate) {
+				_avgCost = cost;
+				_costVariance = 0;
+				_hasCostEstimate = true;
+			} else {
+				double diff = cost - _avgCost;
+				_avgCost += diff * CostSmoothing;
+				_costVariance = (1 - CostSmoothing) * (_costVariance + diff * diff * CostSmoothing);
+			}
+
+			if(isLate) {
+				//Frame missed its deadline, back off immediately
+				_latePenalty = std::min(_latePenalty + LateFramePenalty, MaxLatePenalty);
+				_startDelay = 0;
+				return;
+			}
+			_latePenalty = std::max(0.0, _latePenalty - PenaltyDecay);
+		}
+
+		if(!_hasCostEstimate) {
+			_startDelay = 0;
+			return;
+		}
+
+		double margin = FixedMargin + DeviationCount * std::sqrt(_costVariance) + _latePenalty;
+		_startDelay = std::clamp(_delay - _avgCost - margin, 0.0, _delay * MaxStartDelayRatio);
+	}
+
+	void ResetCostEstimate()
+	{
+		_frameStart = -1;
+		_startDelay = 0;
+		_hasCostEstimate = false;
+		_latePenalty = 0;
+	}
+
 public:
 	FrameLimiter(double delay)
 	{
@@ -23,9 +85,22 @@ public:
 		_resetRunTimers = true;
 	}
 
+	//When enabled, the start of each frame is delayed so that it ends just before its deadline, based
+	//on the time the previous frames took to run (reduces the delay between input polling and display)
+	void SetAdaptiveDelay(bool enabled)
+	{
+		if(_adaptiveDelay != enabled) {
+			_adaptiveDelay = enabled;
+			ResetCostEstimate();
+		}
+	}
+
+	double GetStartDelay() { return _startDelay; }
+
 	void ProcessFrame()
 	{
-		if(_resetRunTimers || (_clockTimer.GetElapsedMS() - _targetTime) > 100) {
+		double now = _clockTimer.GetElapsedMS();
+		if(_resetRunTimers || (now - _targetTime) > 100) {
 			//Reset the timers, this can happen in 3 scenarios:
 			//1) Target frame rate changed
 			//2) The console was reset/power cycled or the emulation was paused (with or without the debugger)
@@ -34,6 +109,11 @@ public:
 			_clockTimer.Reset();
 			_targetTime = 0;
 			_resetRunTimers = false;
+			ResetCostEstimate();
+		} else if(_adaptiveDelay && _delay > 0) {
+			UpdateStartDelay(now);
+		} else {
+			_startDelay = 0;
 		}
 
 		_targetTime += _delay;
@@ -41,13 +121,16 @@ public:
 
 	bool WaitForNextFrame()
 	{
-		if(_targetTime - _clockTimer.GetElapsedMS() > 50) {
+		double waitTarget = _targetTime + _startDelay;
+		if(waitTarget - _clockTimer.GetElapsedMS() > 50) {
 			//When sleeping for a long time (e.g <= 25% speed), sleep in small chunks and check to see if we need to stop sleeping between each sleep call
 			_clockTimer.WaitUntil(_clockTimer.GetElapsedMS() + 40);
+			_frameStart = _clockTimer.GetElapsedMS();
 			return true;
 		}
 
-		_clockTimer.WaitUntil(_targetTime);
+		_clockTimer.WaitUntil(waitTarget);
+		_frameStart = _clockTimer.GetElapsedMS();
 		return false;
 	}
-};
\ No newline at end of file
+};
@@ -0,0 +1,109 @@
+#include "pch.h"
+#include "Shared/PerformanceCounters.h"
+
+const char* PerformanceCounters::GetStageName(PerfStage stage)
+{
+	switch(stage) {
+		case PerfStage::Emulation: return "Emulation";
+		case PerfStage::AudioMixing: return "AudioMixing";
+		case PerfStage::AudioEffects: return "AudioEffects";
+		case PerfStage::AudioOutput: return "AudioOutput";
+		case PerfStage::VideoFilter: return "VideoFilter";
+		case PerfStage::ScaleFilter: return "ScaleFilter";
+		case PerfStage::Hud: return "Hud";
+		case PerfStage::RendererUpload: return "RendererUpload";
+		case PerfStage::Render: return "Render";
+		case PerfStage::FrameLimiter: return "FrameLimiter";
+		default: return "";
+	}
+}
+
+void PerformanceCounters::AddSample(PerfStage stage, uint64_t startTimestamp)
+{
+	uint64_t duration = GetTimestamp() - startTimestamp;
+
+	StageHistory& history = _stages[(int)stage];
+	auto lock = history.Lock.AcquireSafe();
+	history.Samples[history.Position] = (uint32_t)std::min<uint64_t>(duration, UINT32_MAX);
+	history.Position = (history.Position + 1) % HistorySize;
+	history.TotalCount++;
+}
+
+PerfStageStats PerformanceCounters::GetStats(PerfStage stage)
+{
+	uint32_t samples[HistorySize];
+	uint32_t count;
+	uint32_t last;
+	PerfStageStats stats = {};
+
+	{
+		StageHistory& history = _stages[(int)stage];
+		auto lock = history.Lock.AcquireSafe();
+		stats.SampleCount = history.TotalCount;
+		count = (uint32_t)std::min<uint64_t>(history.TotalCount, HistorySize);
+		last = history.Samples[(history.Position + HistorySize - 1) % HistorySize];
+		memcpy(samples, history.Samples, sizeof(samples));
+	}
+
+	if(count == 0) {
+		return stats;
+	}
+
+	//Samples are only partially filled until the window wraps around for the first time, but
+	//they are filled from index 0, so the first "count" entries are always the valid ones
+	constexpr double nsToMs = 1.0 / 1000000;
+	uint64_t total = 0;
+	uint32_t maxValue = 0;
+	for(uint32_t i = 0; i < count; i++) {
+		total += samples[i];
+		maxValue = std::max(maxValue, samples[i]);
+	}
+
+	uint32_t p50 = count / 2;
+	uint32_t p99 = std::min(count - 1, count * 99 / 100);
+	std::nth_element(samples, samples + p99, samples + count);
+	uint32_t p99Value = samples[p99];
+	std::nth_element(samples, samples + p50, samples + p99);
+
+	stats.Last = last * nsToMs;
+	stats.Average = (double)total / count * nsToMs;
+	stats.P50 = (p50 < p99 ? samples[p50] : p99Value) * nsToMs;
+	stats.P99 = p99Value * nsToMs;
+	stats.Max = maxValue * nsToMs;
+	return stats;
+}
+
+void PerformanceCounters::GetStats(PerfStageStats stats[(int)PerfStage::StageCount])
+{
+	for(uint32_t i = 0; i < StageCount; i++) {
+		stats[i] = GetStats((PerfStage)i);
+	}
+}
+
+void PerformanceCounters::Reset()
+{
+	for(uint32_t i = 0; i < StageCount; i++) {
+		StageHistory& history = _stages[i];
+		auto lock = history.Lock.AcquireSafe();
+		memset(history.Samples, 0, sizeof(history.Samples));
+		history.Position = 0;
+		history.TotalCount = 0;
+	}
+}
+
+bool PerformanceCounters::ExportCsv(string filename)
+{
+	ofstream file(filename, ios::out | ios::binary);
+	if(!file) {
+		return false;
+	}
+
+	file << "Stage,Samples,Last (ms),Average (ms),P50 (ms),P99 (ms),Max (ms)\n";
+	file << std::fixed << std::setprecision(4);
+	for(uint32_t i = 0; i < StageCount; i++) {
+		PerfStageStats stats = GetStats((PerfStage)i);
+		file << GetStageName((PerfStage)i) << "," << stats.SampleCount << "," << stats.Last << "," << stats.Average << "," << stats.P50 << "," << stats.P99 << "," << stats.Max << "\n";
+	}
+	file.close();
+	return true;
+}
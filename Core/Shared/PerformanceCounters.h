@@ -0,0 +1,87 @@
+#pragma once
+#include "pch.h"
+#include "Utilities/SimpleLock.h"
+#include <chrono>
+
+enum class PerfStage
+{
+	Emulation,
+	AudioMixing,
+	AudioEffects,
+	AudioOutput,
+	VideoFilter,
+	ScaleFilter,
+	Hud,
+	RendererUpload,
+	Render,
+	FrameLimiter,
+	StageCount
+};
+
+struct PerfStageStats
+{
+	uint64_t SampleCount;
+	double Last;
+	double Average;
+	double P50;
+	double P99;
+	double Max;
+};
+
+//Keeps a rolling window of host-side timings (in nanoseconds) for each stage of the emulation/audio/video pipeline.
+//Stages can be recorded from any thread (emulation, video decoder, renderer), each stage has its own lock.
+class PerformanceCounters
+{
+private:
+	//~10 seconds of history at 60 fps
+	static constexpr uint32_t HistorySize = 600;
+	static constexpr uint32_t StageCount = (uint32_t)PerfStage::StageCount;
+
+	struct StageHistory
+	{
+		SimpleLock Lock;
+		uint32_t Samples[HistorySize] = {};
+		uint32_t Position = 0;
+		uint64_t TotalCount = 0;
+	};
+
+	StageHistory _stages[StageCount];
+
+public:
+	static uint64_t GetTimestamp()
+	{
+		return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	static const char* GetStageName(PerfStage stage);
+
+	void AddSample(PerfStage stage, uint64_t startTimestamp);
+
+	//Returns the stats for the samples currently in the window, durations are in milliseconds
+	PerfStageStats GetStats(PerfStage stage);
+	void GetStats(PerfStageStats stats[(int)PerfStage::StageCount]);
+
+	void Reset();
+	bool ExportCsv(string filename);
+};
+
+class PerfTimer
+{
+private:
+	PerformanceCounters* _counters;
+	PerfStage _stage;
+	uint64_t _start;
+
+public:
+	PerfTimer(PerformanceCounters* counters, PerfStage stage)
+	{
+		_counters = counters;
+		_stage = stage;
+		_start = PerformanceCounters::GetTimestamp();
+	}
+
+	~PerfTimer()
+	{
+		_counters->AddSample(_stage, _start);
+	}
+};
@@ -2,6 +2,7 @@
 #include "pch.h"
 #include "Shared/SettingTypes.h"
 #include "Shared/ControlDeviceState.h"
+#include "Shared/Video/FrameBufferPool.h"
 
 struct RenderedFrame
 {
@@ -14,6 +15,9 @@ struct RenderedFrame
 	uint32_t VideoPhase = 0;
 	vector<ControllerData> InputData;
 
+	//Set when FrameBuffer is a pooled buffer - keeping a copy of the handle keeps the buffer alive without copying it
+	FrameBufferHandle BufferHandle;
+
 	RenderedFrame()
 	{}
 
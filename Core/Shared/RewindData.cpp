@@ -2,12 +2,45 @@
 #include "Shared/RewindData.h"
 #include "Shared/Emulator.h"
 #include "Shared/SaveStateManager.h"
+#include "Shared/RewindDiskCache.h"
 #include "Utilities/CompressionHelper.h"
 
+bool RewindData::DecompressState(vector<uint8_t>& data)
+{
+	if(_diskSegment) {
+		//Page the compressed data back in from the disk, it is not kept in memory afterwards
+		vector<uint8_t> compressedData;
+		if(!_diskSegment->Read(_diskOffset, _diskSize, compressedData)) {
+			return false;
+		}
+		return CompressionHelper::Decompress(compressedData, data);
+	}
+	return CompressionHelper::Decompress(_saveStateData, data);
+}
+
+bool RewindData::MoveToDisk(RewindDiskCache* diskCache)
+{
+	if(_diskSegment || _saveStateData.empty()) {
+		return true;
+	}
+
+	uint32_t offset = 0;
+	shared_ptr<RewindDiskSegment> segment = diskCache->Write(_saveStateData, offset);
+	if(!segment) {
+		return false;
+	}
+
+	_diskSegment = segment;
+	_diskOffset = offset;
+	_diskSize = (uint32_t)_saveStateData.size();
+	vector<uint8_t>().swap(_saveStateData);
+	return true;
+}
+
 void RewindData::GetStateData(stringstream &stateData, deque<RewindData>& prevStates, int32_t position)
 {
 	vector<uint8_t> data;
-	CompressionHelper::Decompress(_saveStateData, data);
+	DecompressState(data);
 
 	if(!IsFullState) {
 		position = (position > 0 ? position : (int32_t)prevStates.size()) - 1;
@@ -26,7 +59,7 @@ void RewindData::ProcessXorState(T& data, deque<RewindData>& prevStates, int32_t
 		if(prevState.IsFullState) {
 			//XOR with previous state to restore state data to its initial state
 			vector<uint8_t> prevStateData;
-			CompressionHelper::Decompress(prevState._saveStateData, prevStateData);
+			prevState.DecompressState(prevStateData);
 			for(size_t i = 0, len = std::min(prevStateData.size(), data.size()); i < len; i++) {
 				data[i] ^= prevStateData[i];
 			}
@@ -38,12 +71,14 @@ void RewindData::ProcessXorState(T& data, deque<RewindData>& prevStates, int32_t
 
 void RewindData::LoadState(Emulator* emu, deque<RewindData>& prevStates, int32_t position, bool sendNotification)
 {
-	if(_saveStateData.size() == 0) {
+	if(GetStateSize() == 0) {
 		return;
 	}
 		
 	vector<uint8_t> data;
-	CompressionHelper::Decompress(_saveStateData, data);
+	if(!DecompressState(data)) {
+		return;
+	}
 
 	if(!IsFullState) {
 		position = (position > 0 ? position : (int32_t)prevStates.size()) - 1;
@@ -4,12 +4,21 @@
 #include "Shared/BaseControlDevice.h"
 
 class Emulator;
+class RewindDiskCache;
+class RewindDiskSegment;
 
 class RewindData
 {
 private:
 	vector<uint8_t> _saveStateData;
 
+	//Set when the state data was moved to disk (_saveStateData is empty in this case)
+	shared_ptr<RewindDiskSegment> _diskSegment;
+	uint32_t _diskOffset = 0;
+	uint32_t _diskSize = 0;
+
+	bool DecompressState(vector<uint8_t>& data);
+
 	template<typename T>
 	void ProcessXorState(T& data, deque<RewindData>& prevStates, int32_t position);
 
@@ -20,7 +29,9 @@ public:
 	bool IsFullState = false;
 
 	void GetStateData(stringstream& stateData, deque<RewindData>& prevStates, int32_t position);
-	uint32_t GetStateSize() { return (uint32_t)_saveStateData.size(); }
+	uint32_t GetStateSize() { return _diskSegment ? _diskSize : (uint32_t)_saveStateData.size(); }
+	bool IsOnDisk() { return _diskSegment != nullptr; }
+	bool MoveToDisk(RewindDiskCache* diskCache);
 
 	void LoadState(Emulator* emu, deque<RewindData>& prevStates, int32_t position = -1, bool sendNotification = true);
 	void SaveState(Emulator* emu, deque<RewindData>& prevStates, int32_t position = -1);
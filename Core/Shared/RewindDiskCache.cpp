@@ -0,0 +1,87 @@
+#include "pch.h"
+#include <random>
+#include <mutex>
+#include "Shared/RewindDiskCache.h"
+#include "Utilities/FolderUtilities.h"
+#include "Utilities/HexUtilities.h"
+
+RewindDiskSegment::RewindDiskSegment(string filename)
+{
+	_filename = filename;
+	_file.open(filename, ios::in | ios::out | ios::binary | ios::trunc);
+}
+
+RewindDiskSegment::~RewindDiskSegment()
+{
+	_file.close();
+	std::remove(_filename.c_str());
+}
+
+bool RewindDiskSegment::IsValid()
+{
+	return _file.good();
+}
+
+bool RewindDiskSegment::Append(vector<uint8_t>& data, uint32_t& offset)
+{
+	auto lock = _lock.AcquireSafe();
+	_file.seekp(_size, ios::beg);
+	_file.write((char*)data.data(), data.size());
+	if(!_file.good()) {
+		_file.clear();
+		return false;
+	}
+
+	offset = _size;
+	_size += (uint32_t)data.size();
+	return true;
+}
+
+bool RewindDiskSegment::Read(uint32_t offset, uint32_t length, vector<uint8_t>& data)
+{
+	//Blocks can be read by the history viewer's thread while the emulation thread is appending to the file
+	auto lock = _lock.AcquireSafe();
+	data.resize(length);
+	_file.seekg(offset, ios::beg);
+	_file.read((char*)data.data(), length);
+	if(!_file.good()) {
+		_file.clear();
+		return false;
+	}
+	return true;
+}
+
+RewindDiskCache::RewindDiskCache()
+{
+	static std::once_flag cleanupFlag;
+	std::call_once(cleanupFlag, &RewindDiskCache::DeleteUnusedFiles);
+
+	std::random_device rd;
+	_filePrefix = FolderUtilities::CombinePath(FolderUtilities::GetRewindFolder(), "History_" + HexUtilities::ToHex((uint32_t)rd()) + "_");
+}
+
+shared_ptr<RewindDiskSegment> RewindDiskCache::Write(vector<uint8_t>& data, uint32_t& offset)
+{
+	if(!_currentSegment || _currentSegment->GetSize() + data.size() > RewindDiskCache::MaxSegmentSize) {
+		//Start a new segment - the previous one is deleted once all of its blocks have been discarded
+		_currentSegment.reset(new RewindDiskSegment(_filePrefix + std::to_string(_segmentCounter++) + RewindDiskCache::FileExtension));
+		if(!_currentSegment->IsValid()) {
+			_currentSegment.reset();
+			return nullptr;
+		}
+	}
+
+	if(!_currentSegment->Append(data, offset)) {
+		return nullptr;
+	}
+	return _currentSegment;
+}
+
+void RewindDiskCache::DeleteUnusedFiles()
+{
+	//Remove files left behind by a previous session that did not shut down properly
+	//Files that are still opened by another instance can't be removed on Windows, and are unlinked but remain usable on other OSes
+	for(string& file : FolderUtilities::GetFilesInFolder(FolderUtilities::GetRewindFolder(), { RewindDiskCache::FileExtension }, false)) {
+		std::remove(file.c_str());
+	}
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include "pch.h"
+#include "Utilities/SimpleLock.h"
+
+//An append-only file that contains the compressed state data of rewind blocks that were moved out of memory.
+//Each block that was written to a segment keeps a reference to it - the file is deleted once no block uses it anymore.
+class RewindDiskSegment
+{
+private:
+	string _filename;
+	fstream _file;
+	SimpleLock _lock;
+	uint32_t _size = 0;
+
+public:
+	RewindDiskSegment(string filename);
+	~RewindDiskSegment();
+
+	bool IsValid();
+	uint32_t GetSize() { return _size; }
+
+	bool Append(vector<uint8_t>& data, uint32_t& offset);
+	bool Read(uint32_t offset, uint32_t length, vector<uint8_t>& data);
+};
+
+class RewindDiskCache
+{
+private:
+	static constexpr uint32_t MaxSegmentSize = 64 * 1024 * 1024;
+	static constexpr const char* FileExtension = ".mrh";
+
+	string _filePrefix;
+	uint32_t _segmentCounter = 0;
+	shared_ptr<RewindDiskSegment> _currentSegment;
+
+	static void DeleteUnusedFiles();
+
+public:
+	RewindDiskCache();
+
+	shared_ptr<RewindDiskSegment> Write(vector<uint8_t>& data, uint32_t& offset);
+};
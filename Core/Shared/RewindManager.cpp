@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Shared/RewindManager.h"
+#include "Shared/RewindDiskCache.h"
 #include "Shared/MessageManager.h"
 #include "Shared/Emulator.h"
 #include "Shared/EmuSettings.h"
@@ -45,6 +46,7 @@ void RewindManager::ClearBuffer()
 	_hasHistory = false;
 	_history.clear();
 	_historyBackup.clear();
+	_diskCache.reset();
 	_framesToFastForward = 0;
 	_videoHistory.clear();
 	_videoHistoryBuilder.clear();
@@ -107,35 +109,71 @@ void RewindManager::ProcessNotification(ConsoleNotificationType type, void * par
 RewindStats RewindManager::GetStats()
 {
 	uint32_t memoryUsage = 0;
+	uint64_t diskUsage = 0;
 	for(int i = (int)_history.size() - 1; i >= 0; i--) {
-		memoryUsage += _history[i].GetStateSize();
+		if(_history[i].IsOnDisk()) {
+			diskUsage += _history[i].GetStateSize();
+		} else {
+			memoryUsage += _history[i].GetStateSize();
+		}
 	}
 	
 	RewindStats stats = {};
 	stats.MemoryUsage = memoryUsage;
+	stats.DiskUsage = diskUsage;
 	stats.HistorySize = (uint32_t)_history.size();
 	stats.HistoryDuration = stats.HistorySize * RewindManager::BufferSize;
 	return stats;
 }
 
+void RewindManager::RemoveOldHistory(int32_t count)
+{
+	//Remove all old state data above the memory/disk limit
+	for(int j = 0; j < count; j++) {
+		_history.pop_front();
+	}
+
+	while(_history.size() > 0 && !_history.front().IsFullState) {
+		//Remove everything until the next full state
+		_history.pop_front();
+	}
+}
+
 void RewindManager::AddHistoryBlock()
 {
 	uint32_t maxHistorySize = _settings->GetPreferences().RewindBufferSize;
+	uint32_t maxDiskHistorySize = _settings->GetPreferences().RewindDiskBufferSize;
 	if(maxHistorySize > 0) {
 		uint32_t memoryUsage = 0;
+		uint64_t diskUsage = 0;
 		for(int i = (int)_history.size() - 1; i >= 0; i--) {
-			memoryUsage += _history[i].GetStateSize();
-			if((memoryUsage >> 20) >= maxHistorySize) {
-				//Remove all old state data above the memory limit
-				for(int j = 0; j < i; j++) {
-					_history.pop_front();
+			RewindData& block = _history[i];
+			if(!block.IsOnDisk()) {
+				memoryUsage += block.GetStateSize();
+				if((memoryUsage >> 20) >= maxHistorySize) {
+					if(maxDiskHistorySize == 0) {
+						RemoveOldHistory(i);
+						break;
+					}
+
+					//Move the blocks that don't fit in memory anymore to the disk (oldest blocks are always on the disk)
+					if(!_diskCache) {
+						_diskCache.reset(new RewindDiskCache());
+					}
+					if(!block.MoveToDisk(_diskCache.get())) {
+						//Could not write to the disk, discard the older blocks instead
+						RemoveOldHistory(i);
+						break;
+					}
 				}
+			}
 
-				while(_history.size() > 0 && !_history.front().IsFullState) {
-					//Remove everything until the next full state
-					_history.pop_front();
+			if(block.IsOnDisk()) {
+				diskUsage += block.GetStateSize();
+				if((diskUsage >> 20) >= maxDiskHistorySize) {
+					RemoveOldHistory(i);
+					break;
 				}
-				break;
 			}
 		}
 
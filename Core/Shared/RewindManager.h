@@ -8,6 +8,7 @@
 
 class Emulator;
 class EmuSettings;
+class RewindDiskCache;
 struct RenderedFrame;
 
 enum class RewindState
@@ -32,6 +33,7 @@ struct VideoFrame
 struct RewindStats
 {
 	uint32_t MemoryUsage;
+	uint64_t DiskUsage;
 	uint32_t HistorySize;
 	uint32_t HistoryDuration;
 };
@@ -49,6 +51,7 @@ private:
 
 	deque<RewindData> _history;
 	deque<RewindData> _historyBackup;
+	unique_ptr<RewindDiskCache> _diskCache;
 	RewindData _currentHistory = {};
 
 	RewindState _rewindState = RewindState::Stopped;
@@ -60,6 +63,7 @@ private:
 	vector<int16_t> _audioHistoryBuilder;
 
 	void AddHistoryBlock();
+	void RemoveOldHistory(int32_t count);
 	void PopHistory();
 
 	void Start(bool forDebugger);
@@ -2,6 +2,7 @@
 #include "pch.h"
 #include "Shared/Emulator.h"
 #include "Shared/MessageManager.h"
+#include "Shared/RomLibraryIndex.h"
 #include "Utilities/VirtualFile.h"
 #include "Utilities/FolderUtilities.h"
 #include "Utilities/HexUtilities.h"
@@ -16,31 +17,23 @@ private:
 			return emu->GetRomInfo().RomFile;
 		}
 
-		string lcRomname = romName;
-		std::transform(lcRomname.begin(), lcRomname.end(), lcRomname.begin(), ::tolower);
-
-		vector<string> romFiles;
 		vector<string> folders = FolderUtilities::GetKnownGameFolders();
 		if(emu->IsRunning()) {
 			//Look in the same folder as the current game first
 			folders.insert(folders.begin(), emu->GetRomInfo().RomFile.GetFolderPath());
 		}
 
+		vector<string> searchFolders;
 		unordered_set<string> checkedFolders;
-		for(string folder : folders) {
-			if(!checkedFolders.emplace(folder).second) {
-				//Already checked this folder
-				continue;
+		for(string& folder : folders) {
+			if(checkedFolders.emplace(folder).second) {
+				searchFolders.push_back(folder);
 			}
+		}
 
-			for(string romFilename : FolderUtilities::GetFilesInFolder(folder, VirtualFile::RomExtensions, true)) {
-				string lcRomFile = romFilename;
-				std::transform(lcRomFile.begin(), lcRomFile.end(), lcRomFile.begin(), ::tolower);
-
-				if(FolderUtilities::GetFilename(lcRomname, false) == FolderUtilities::GetFilename(lcRomFile, false) && VirtualFile(romFilename).GetCrc32() == crc32) {
-					return romFilename;
-				}
-			}
+		string match = RomLibraryIndex::FindFile(romName, crc32, searchFolders);
+		if(!match.empty()) {
+			return match;
 		}
 
 		MessageManager::Log("Could not find matching file: " + romName + "  CRC32: " + HexUtilities::ToHex(crc32, true));
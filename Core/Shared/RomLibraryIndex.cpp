@@ -0,0 +1,249 @@
+#include "pch.h"
+#include <thread>
+#include "Shared/RomLibraryIndex.h"
+#include "Utilities/VirtualFile.h"
+#include "Utilities/FolderUtilities.h"
+
+unordered_map<string, RomLibraryIndex::Entry> RomLibraryIndex::_entries;
+bool RomLibraryIndex::_loaded = false;
+bool RomLibraryIndex::_modified = false;
+SimpleLock RomLibraryIndex::_lock;
+
+string RomLibraryIndex::GetIndexPath()
+{
+	return FolderUtilities::CombinePath(FolderUtilities::GetHomeFolder(), "RomLibraryIndex.dat");
+}
+
+string RomLibraryIndex::GetLcName(const string& filepath)
+{
+	string name = FolderUtilities::GetFilename(filepath, false);
+	std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+	return name;
+}
+
+int32_t RomLibraryIndex::GetFolderIndex(const string& filepath, const vector<string>& folders)
+{
+	for(size_t i = 0; i < folders.size(); i++) {
+		const string& folder = folders[i];
+		if(folder.empty() || filepath.size() <= folder.size() || filepath.compare(0, folder.size(), folder) != 0) {
+			continue;
+		}
+
+		//Make sure the folder name isn't only a prefix of another folder's name (e.g "Games" vs "Games2")
+		char lastChar = folder.back();
+		char nextChar = filepath[folder.size()];
+		if(lastChar == '/' || lastChar == '\\' || nextChar == '/' || nextChar == '\\') {
+			return (int32_t)i;
+		}
+	}
+	return -1;
+}
+
+void RomLibraryIndex::Load()
+{
+	if(_loaded) {
+		return;
+	}
+	_loaded = true;
+
+	ifstream file(GetIndexPath(), ios::in | ios::binary);
+	if(!file) {
+		return;
+	}
+
+	uint32_t signature = 0;
+	uint32_t version = 0;
+	uint32_t count = 0;
+	file.read((char*)&signature, sizeof(signature));
+	file.read((char*)&version, sizeof(version));
+	file.read((char*)&count, sizeof(count));
+	if(!file || signature != FileSignature || version != FileVersion) {
+		return;
+	}
+
+	for(uint32_t i = 0; i < count; i++) {
+		uint32_t pathLength = 0;
+		file.read((char*)&pathLength, sizeof(pathLength));
+		if(!file || pathLength == 0 || pathLength > 0x10000) {
+			break;
+		}
+
+		string path(pathLength, 0);
+		Entry entry;
+		uint8_t hasCrc = 0;
+		file.read(path.data(), pathLength);
+		file.read((char*)&entry.Size, sizeof(entry.Size));
+		file.read((char*)&entry.ModifiedTime, sizeof(entry.ModifiedTime));
+		file.read((char*)&entry.Crc32, sizeof(entry.Crc32));
+		file.read((char*)&hasCrc, sizeof(hasCrc));
+		if(!file) {
+			break;
+		}
+
+		entry.HasCrc = hasCrc != 0;
+		entry.LcName = GetLcName(path);
+		_entries[path] = std::move(entry);
+	}
+}
+
+void RomLibraryIndex::Save()
+{
+	if(!_modified) {
+		return;
+	}
+	_modified = false;
+
+	ofstream file(GetIndexPath(), ios::out | ios::binary);
+	if(!file) {
+		return;
+	}
+
+	uint32_t signature = FileSignature;
+	uint32_t version = FileVersion;
+	uint32_t count = (uint32_t)_entries.size();
+	file.write((char*)&signature, sizeof(signature));
+	file.write((char*)&version, sizeof(version));
+	file.write((char*)&count, sizeof(count));
+
+	for(auto& [path, entry] : _entries) {
+		uint32_t pathLength = (uint32_t)path.size();
+		uint8_t hasCrc = entry.HasCrc ? 1 : 0;
+		file.write((char*)&pathLength, sizeof(pathLength));
+		file.write(path.data(), pathLength);
+		file.write((char*)&entry.Size, sizeof(entry.Size));
+		file.write((char*)&entry.ModifiedTime, sizeof(entry.ModifiedTime));
+		file.write((char*)&entry.Crc32, sizeof(entry.Crc32));
+		file.write((char*)&hasCrc, sizeof(hasCrc));
+	}
+}
+
+RomLibraryIndex::Entry& RomLibraryIndex::AddEntry(const string& filepath)
+{
+	auto result = _entries.try_emplace(filepath);
+	if(result.second) {
+		result.first->second.LcName = GetLcName(filepath);
+		_modified = true;
+	}
+	return result.first->second;
+}
+
+string RomLibraryIndex::FindMatch(const vector<string>& candidates, uint32_t crc32)
+{
+	//Candidates are in order of preference - the first candidate with a matching CRC is returned
+	//Candidates that no longer exist are removed from the list (and from the index)
+	vector<string> files;
+	vector<string> filesToHash;
+	for(const string& path : candidates) {
+		uint64_t size;
+		int64_t modifiedTime;
+		if(!FolderUtilities::GetFileInfo(path, size, modifiedTime)) {
+			//File no longer exists
+			_modified |= _entries.erase(path) > 0;
+			continue;
+		}
+
+		//Cached CRCs are only used if the file hasn't changed since it was last hashed
+		Entry& entry = AddEntry(path);
+		if(!entry.HasCrc || entry.Size != size || entry.ModifiedTime != modifiedTime) {
+			entry.Size = size;
+			entry.ModifiedTime = modifiedTime;
+			entry.HasCrc = false;
+			filesToHash.push_back(path);
+		} else if(entry.Crc32 == crc32 && filesToHash.empty()) {
+			//All previous candidates are known not to match
+			return path;
+		}
+		files.push_back(path);
+	}
+
+	auto getFirstMatch = [&]() -> string {
+		for(const string& path : files) {
+			Entry& entry = _entries[path];
+			if(!entry.HasCrc) {
+				//This file hasn't been hashed yet, later matches can't be returned yet
+				break;
+			} else if(entry.Crc32 == crc32) {
+				return path;
+			}
+		}
+		return "";
+	};
+
+	//Hash the remaining candidates in parallel (archives need to be decompressed, which can be slow)
+	uint32_t threadCount = std::clamp<uint32_t>(std::thread::hardware_concurrency(), 1, 8);
+	for(size_t start = 0; start < filesToHash.size(); start += threadCount) {
+		size_t count = std::min<size_t>(threadCount, filesToHash.size() - start);
+		vector<uint32_t> crcs(count);
+		vector<std::thread> threads;
+		for(size_t i = 1; i < count; i++) {
+			threads.emplace_back([&crcs, &filesToHash, start, i]() {
+				crcs[i] = VirtualFile(filesToHash[start + i]).GetCrc32();
+			});
+		}
+		crcs[0] = VirtualFile(filesToHash[start]).GetCrc32();
+		for(std::thread& thread : threads) {
+			thread.join();
+		}
+
+		for(size_t i = 0; i < count; i++) {
+			Entry& entry = _entries[filesToHash[start + i]];
+			entry.Crc32 = crcs[i];
+			entry.HasCrc = true;
+			_modified = true;
+		}
+
+		string match = getFirstMatch();
+		if(!match.empty()) {
+			return match;
+		}
+	}
+
+	return getFirstMatch();
+}
+
+string RomLibraryIndex::FindFile(const string& romName, uint32_t crc32, const vector<string>& folders)
+{
+	auto lock = _lock.AcquireSafe();
+	Load();
+
+	string lcRomName = GetLcName(romName);
+
+	//Check the files already in the index first, this avoids enumerating the content of every folder
+	vector<std::pair<int32_t, string>> indexedFiles;
+	for(auto& [path, entry] : _entries) {
+		if(entry.LcName == lcRomName) {
+			int32_t folderIndex = GetFolderIndex(path, folders);
+			if(folderIndex >= 0) {
+				indexedFiles.emplace_back(folderIndex, path);
+			}
+		}
+	}
+
+	//Sort by folder (in the order given by the caller), then by path to keep the result consistent
+	std::sort(indexedFiles.begin(), indexedFiles.end());
+	vector<string> candidates;
+	for(auto& [folderIndex, path] : indexedFiles) {
+		candidates.push_back(path);
+	}
+
+	string match = FindMatch(candidates, crc32);
+	if(match.empty()) {
+		//No match in the index (new files, or the index is out of date), rescan the folders
+		unordered_set<string> checkedFiles(candidates.begin(), candidates.end());
+		candidates.clear();
+
+		for(const string& folder : folders) {
+			for(const string& romFilename : FolderUtilities::GetFilesInFolder(folder, VirtualFile::RomExtensions, true)) {
+				//Only files with a matching name are added to the index (by FindMatch), to keep the index small
+				if(GetLcName(romFilename) == lcRomName && checkedFiles.emplace(romFilename).second) {
+					candidates.push_back(romFilename);
+				}
+			}
+		}
+
+		match = FindMatch(candidates, crc32);
+	}
+
+	Save();
+	return match;
+}
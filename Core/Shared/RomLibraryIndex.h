@@ -0,0 +1,44 @@
+#pragma once
+#include "pch.h"
+#include "Utilities/SimpleLock.h"
+
+//Persistent index of the roms found in the game folders by previous lookups, along with their CRC32.
+//Lookups check the indexed files first and only enumerate the game folders again when no
+//indexed file matches. Only files whose name matched a lookup are added to the index.
+//Cached CRCs are only used if the file's size and modification time have not changed since
+//the file was hashed.
+class RomLibraryIndex
+{
+private:
+	static constexpr uint32_t FileSignature = 0x58444952; //RIDX
+	static constexpr uint32_t FileVersion = 1;
+
+	struct Entry
+	{
+		uint64_t Size = 0;
+		int64_t ModifiedTime = 0;
+		uint32_t Crc32 = 0;
+		bool HasCrc = false;
+		string LcName; //Lowercase filename without extension (not saved)
+	};
+
+	static unordered_map<string, Entry> _entries;
+	static bool _loaded;
+	static bool _modified;
+	static SimpleLock _lock;
+
+	static string GetIndexPath();
+	static string GetLcName(const string& filepath);
+	static int32_t GetFolderIndex(const string& filepath, const vector<string>& folders);
+
+	static void Load();
+	static void Save();
+
+	static Entry& AddEntry(const string& filepath);
+	static string FindMatch(const vector<string>& candidates, uint32_t crc32);
+
+public:
+	//Returns the path of a file with the same name (ignoring the extension) and CRC32 in the given folders, or an empty string
+	//When several files match, files in the first folders of the list are preferred
+	static string FindFile(const string& romName, uint32_t crc32, const vector<string>& folders);
+};
@@ -10,6 +10,7 @@ enum class EmulationFlags
 	MaximumSpeed = 0x04,
 	InBackground = 0x08,
 	ConsoleMode = 0x10,
+	AudioOnly = 0x20,
 };
 
 enum class ScaleFilterType
@@ -113,6 +114,13 @@ struct VideoConfig
 	uint32_t ScreenRotation = 0;
 };
 
+enum class AudioResamplingQuality
+{
+	Hermite = 0,
+	Medium = 1,
+	High = 2
+};
+
 struct AudioConfig
 {
 	const char* AudioDevice = nullptr;
@@ -122,6 +130,7 @@ struct AudioConfig
 	uint32_t MasterVolume = 100;
 	uint32_t SampleRate = 48000;
 	uint32_t AudioLatency = 60;
+	AudioResamplingQuality ResamplingQuality = AudioResamplingQuality::Medium;
 
 	bool MuteSoundInBackground = false;
 	bool ReduceSoundInBackground = true;
@@ -358,6 +367,8 @@ struct EmulationConfig
 	uint32_t RewindSpeed = 100;
 
 	uint32_t RunAheadFrames = 0;
+	bool JustInTimeInputPolling = false;
+	bool AdaptiveFrameDelay = false;
 };
 
 struct OverscanDimensions
@@ -382,6 +393,7 @@ struct GameboyConfig
 
 	GameboyModel Model = GameboyModel::AutoFavorGbc;
 	bool UseSgb2 = true;
+	bool RunSgbOnSeparateThread = false;
 
 	bool BlendFrames = true;
 	bool GbcAdjustColors = true;
@@ -483,6 +495,8 @@ struct SnesConfig
 
 	bool EnableRandomPowerOnState = false;
 	bool EnableStrictBoardMappings = false;
+	bool RunSpcOnSeparateThread = false;
+	bool RunPpuCompositingOnSeparateThread = false;
 	RamState RamPowerOnState = RamState::Random;
 	int32_t SpcClockSpeedAdjustment = 0;
 
@@ -714,6 +728,7 @@ struct PreferencesConfig
 
 	uint32_t AutoSaveStateDelay = 5;
 	uint32_t RewindBufferSize = 300;
+	uint32_t RewindDiskBufferSize = 0;
 
 	const char* SaveFolderOverride = nullptr;
 	const char* SaveStateFolderOverride = nullptr;
@@ -924,4 +939,7 @@ enum class DebuggerFlags
 	NesDebuggerEnabled = (1 << 7),
 	PceDebuggerEnabled = (1 << 8),
 	SmsDebuggerEnabled = (1 << 9),
+
+	AccessCountersEnabled = (1 << 10),
+	EventViewerEnabled = (1 << 11),
 };
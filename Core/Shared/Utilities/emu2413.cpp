@@ -230,6 +230,9 @@ static double kl_table[16] = {dB2(0.000),  dB2(9.000),  dB2(12.000), dB2(13.875)
 static uint32_t tll_table[8 * 16][1 << TL_BITS][4];
 static int32_t rks_table[8 * 2][2];
 
+/* noise state after 14 ([0]) or 2 ([1]) steps, for each byte of the current state */
+static uint32_t noise_jump_table[2][4][256];
+
 static OPLL_PATCH null_patch = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
 static OPLL_PATCH default_patch[OPLL_TONE_NUM][(16 + 3) * 2];
 
@@ -404,6 +407,29 @@ static void makeRksTable(void) {
     }
 }
 
+static uint32_t step_noise(uint32_t noise, int cycle) {
+  int i;
+  for (i = 0; i < cycle; i++) {
+    if (noise & 1) {
+      noise ^= 0x800200;
+    }
+    noise >>= 1;
+  }
+  return noise;
+}
+
+/* The noise generator is an xor-based LFSR, so running it N steps is a linear function of its state,
+ * which can be applied one byte at a time with precomputed tables instead of looping N times. */
+static void makeNoiseJumpTable(void) {
+  int i, b;
+  for (b = 0; b < 4; b++) {
+    for (i = 0; i < 256; i++) {
+      noise_jump_table[0][b][i] = step_noise((uint32_t)i << (b * 8), 14);
+      noise_jump_table[1][b][i] = step_noise((uint32_t)i << (b * 8), 2);
+    }
+  }
+}
+
 static void makeDefaultPatch(void) {
   int i, j;
   for (i = 0; i < OPLL_TONE_NUM; i++)
@@ -417,6 +443,7 @@ static void initializeTables(void) {
   makeTllTable();
   makeRksTable();
   makeSinTable();
+  makeNoiseJumpTable();
   makeDefaultPatch();
   table_initialized = 1;
 }
@@ -543,6 +570,8 @@ static void commit_slot_update(OPLL_SLOT *slot) {
       slot->eg_shift = 0;
       slot->eg_rate_h = 0;
       slot->eg_rate_l = 0;
+      /* everything that affects the rate requests an update, no need to run this again on the next sample */
+      slot->update_requests = 0;
       return;
     }
 
@@ -738,14 +767,11 @@ static void update_ampm(OPLL *opll) {
   opll->lfo_am = am_table[(opll->am_phase >> 6) % sizeof(am_table)];
 }
 
-static void update_noise(OPLL *opll, int cycle) {
-  int i;
-  for (i = 0; i < cycle; i++) {
-    if (opll->noise & 1) {
-      opll->noise ^= 0x800200;
-    }
-    opll->noise >>= 1;
-  }
+/* table: 0 = 14 steps, 1 = 2 steps */
+static INLINE void update_noise(OPLL *opll, int table) {
+  const uint32_t n = opll->noise;
+  const uint32_t(*jump)[256] = noise_jump_table[table];
+  opll->noise = jump[0][n & 0xff] ^ jump[1][(n >> 8) & 0xff] ^ jump[2][(n >> 16) & 0xff] ^ jump[3][n >> 24];
 }
 
 static void update_short_noise(OPLL *opll) {
@@ -902,7 +928,11 @@ static void update_slots(OPLL *opll) {
     if (slot->update_requests) {
       commit_slot_update(slot);
     }
-    calc_envelope(slot, buddy, opll->eg_counter, opll->test_flag & 1);
+    /* Envelopes in the sustain/release states with a rate of 0 (or that are fully attenuated) can't change */
+    if ((opll->test_flag & 1) || (slot->eg_state != SUSTAIN && slot->eg_state != RELEASE) ||
+        (slot->eg_rate_h > 0 && slot->eg_out != EG_MUTE)) {
+      calc_envelope(slot, buddy, opll->eg_counter, opll->test_flag & 1);
+    }
     calc_phase(slot, opll->pm_phase, opll->test_flag & 4);
   }
 }
@@ -1023,7 +1053,7 @@ static void update_output(OPLL *opll) {
         out[9] = _RO(calc_slot_car(opll, 6, calc_slot_mod(opll, 6)));
       }
     }
-    update_noise(opll, 14);
+    update_noise(opll, 0);
 
     /* CH8 */
     if (!opll->rhythm_mode) {
@@ -1038,7 +1068,7 @@ static void update_output(OPLL *opll) {
         out[11] = _RO(calc_slot_snare(opll));
       }
     }
-    update_noise(opll, 2);
+    update_noise(opll, 1);
    
     /* CH9 */
     if (!opll->rhythm_mode) {
@@ -1053,7 +1083,7 @@ static void update_output(OPLL *opll) {
         out[13] = _RO(calc_slot_cym(opll));
       }
     }
-    update_noise(opll, 2);
+    update_noise(opll, 1);
   }
 }
 
@@ -1475,7 +1505,7 @@ void OPLL_resetPatch(OPLL *opll, uint8_t type) {
     OPLL_copyPatch(opll, i, &default_patch[type % OPLL_TONE_NUM][i]);
 }
 
-int16_t OPLL_calc(OPLL *opll) {
+static INLINE int16_t calc_sample(OPLL *opll) {
   while (opll->out_step > opll->out_time) {
     opll->out_time += opll->inp_step;
     update_output(opll);
@@ -1488,6 +1518,15 @@ int16_t OPLL_calc(OPLL *opll) {
   return opll->mix_out[0];
 }
 
+int16_t OPLL_calc(OPLL *opll) { return calc_sample(opll); }
+
+void OPLL_calcBlock(OPLL *opll, int16_t *out, uint32_t count) {
+  uint32_t i;
+  for (i = 0; i < count; i++) {
+    out[i] = calc_sample(opll);
+  }
+}
+
 void OPLL_calcStereo(OPLL *opll, int32_t out[2]) {
   while (opll->out_step > opll->out_time) {
     opll->out_time += opll->inp_step;
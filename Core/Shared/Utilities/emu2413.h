@@ -180,6 +180,11 @@ void OPLL_writeReg(OPLL *opll, uint32_t reg, uint8_t val);
  */
 int16_t OPLL_calc(OPLL *opll);
 
+/**
+ * Calculate count samples (same output as calling OPLL_calc count times)
+ */
+void OPLL_calcBlock(OPLL *opll, int16_t *out, uint32_t count);
+
 /**
  * Calulate stereo sample
  */
@@ -18,12 +18,13 @@ BaseVideoFilter::BaseVideoFilter(Emulator* emu)
 {
 	_emu = emu;
 	_overscan = _emu->GetSettings()->GetOverscan();
+	_bufferPool = FrameBufferPool::Create();
 }
 
 BaseVideoFilter::~BaseVideoFilter()
 {
 	auto lock = _frameLock.AcquireSafe();
-	delete[] _outputBuffer;
+	_outputBuffer.reset();
 }
 
 void BaseVideoFilter::SetBaseFrameInfo(FrameInfo frameInfo)
@@ -42,14 +43,9 @@ FrameInfo BaseVideoFilter::GetFrameInfo()
 
 void BaseVideoFilter::UpdateBufferSize()
 {
-	uint32_t newBufferSize = _frameInfo.Width*_frameInfo.Height;
-	if(_bufferSize != newBufferSize) {
-		_frameLock.Acquire();
-		delete[] _outputBuffer;
-		_bufferSize = newBufferSize;
-		_outputBuffer = new uint32_t[newBufferSize];
-		_frameLock.Release();
-	}
+	//Use a new buffer for every frame - the previous frame's buffer may still be in use by the renderer
+	_bufferSize = _frameInfo.Width*_frameInfo.Height;
+	_outputBuffer = _bufferPool->Acquire(_bufferSize);
 }
 
 OverscanDimensions BaseVideoFilter::GetOverscan()
@@ -110,6 +106,11 @@ FrameInfo BaseVideoFilter::SendFrame(uint16_t *ppuOutputBuffer, uint32_t frameNu
 }
 
 uint32_t* BaseVideoFilter::GetOutputBuffer()
+{
+	return _outputBuffer.get();
+}
+
+FrameBufferHandle BaseVideoFilter::GetOutputBufferHandle()
 {
 	return _outputBuffer;
 }
@@ -2,13 +2,15 @@
 #include "pch.h"
 #include "Utilities/SimpleLock.h"
 #include "Shared/SettingTypes.h"
+#include "Shared/Video/FrameBufferPool.h"
 
 class Emulator;
 
 class BaseVideoFilter
 {
 private:
-	uint32_t* _outputBuffer = nullptr;
+	shared_ptr<FrameBufferPool> _bufferPool;
+	FrameBufferHandle _outputBuffer;
 	double _yiqToRgbMatrix[6] = {};
 	uint32_t _bufferSize = 0;
 	SimpleLock _frameLock;
@@ -47,6 +49,7 @@ public:
 	virtual ~BaseVideoFilter();
 
 	uint32_t* GetOutputBuffer();
+	FrameBufferHandle GetOutputBufferHandle();
 	FrameInfo SendFrame(uint16_t *ppuOutputBuffer, uint32_t frameNumber, uint32_t videoPhase, void* frameData, bool enableOverscan = true);
 	void TakeScreenshot(string romName, VideoFilterType filterType);
 	void TakeScreenshot(VideoFilterType filterType, string filename, std::stringstream *stream = nullptr);
@@ -6,6 +6,7 @@
 #include "Shared/Emulator.h"
 #include "Shared/RewindManager.h"
 #include "Shared/EmuSettings.h"
+#include "Shared/PerformanceCounters.h"
 
 void DebugStats::DisplayStats(Emulator *emu, double lastFrameTime)
 {
@@ -99,8 +100,32 @@ void DebugStats::DisplayStats(Emulator *emu, double lastFrameTime)
 	hud->DrawString(10, 73, ss.str(), 0xFFFFFF, 0xFF000000, 1, startFrame);
 
 	if(rewindStats.HistoryDuration > 0) {
+		double totalUsage = memUsage + (double)rewindStats.DiskUsage / (1024 * 1024);
 		ss = std::stringstream();
-		ss << "   Per min.: " << std::fixed << std::setprecision(2) << (memUsage * 60 * 60 / rewindStats.HistoryDuration) << " MB";
+		ss << "   Per min.: " << std::fixed << std::setprecision(2) << (totalUsage * 60 * 60 / rewindStats.HistoryDuration) << " MB";
 		hud->DrawString(9, 82, ss.str(), 0xFFFFFF, 0xFF000000, 1, startFrame);
 	}
+
+	constexpr int stageCount = (int)PerfStage::StageCount;
+	PerfStageStats perfStats[stageCount];
+	emu->GetPerformanceCounters()->GetStats(perfStats);
+
+	hud->DrawRectangle(8, 96, 239, 21 + stageCount * 9, 0x40000000, true, 1, startFrame);
+	hud->DrawRectangle(8, 96, 239, 21 + stageCount * 9, 0xFFFFFF, false, 1, startFrame);
+	hud->DrawString(10, 98, "Host Stats", 0xFFFFFF, 0xFF000000, 1, startFrame);
+	hud->DrawString(110, 98, "P50 (ms)", 0xFFFFFF, 0xFF000000, 1, startFrame);
+	hud->DrawString(175, 98, "P99 (ms)", 0xFFFFFF, 0xFF000000, 1, startFrame);
+
+	for(int i = 0; i < stageCount; i++) {
+		int y = 109 + i * 9;
+		hud->DrawString(10, y, PerformanceCounters::GetStageName((PerfStage)i), 0xFFFFFF, 0xFF000000, 1, startFrame);
+
+		ss = std::stringstream();
+		ss << std::fixed << std::setprecision(3) << perfStats[i].P50;
+		hud->DrawString(110, y, ss.str(), 0xFFFFFF, 0xFF000000, 1, startFrame);
+
+		ss = std::stringstream();
+		ss << std::fixed << std::setprecision(3) << perfStats[i].P99;
+		hud->DrawString(175, y, ss.str(), 0xFFFFFF, 0xFF000000, 1, startFrame);
+	}
 }
@@ -0,0 +1,49 @@
+#include "pch.h"
+#include "Shared/Video/FrameBufferPool.h"
+
+FrameBufferPool::~FrameBufferPool()
+{
+	for(uint32_t* buffer : _freeBuffers) {
+		delete[] buffer;
+	}
+}
+
+FrameBufferHandle FrameBufferPool::Acquire(uint32_t pixelCount)
+{
+	uint32_t* buffer = nullptr;
+	{
+		auto lock = _lock.AcquireSafe();
+		if(_bufferSize != pixelCount) {
+			//Frame size changed, buffers of the previous size are freed as they get released
+			for(uint32_t* freeBuffer : _freeBuffers) {
+				delete[] freeBuffer;
+			}
+			_freeBuffers.clear();
+			_bufferSize = pixelCount;
+		}
+
+		if(!_freeBuffers.empty()) {
+			buffer = _freeBuffers.back();
+			_freeBuffers.pop_back();
+		}
+	}
+
+	if(!buffer) {
+		buffer = new uint32_t[pixelCount];
+		memset(buffer, 0, pixelCount * sizeof(uint32_t));
+	}
+
+	//The handle keeps the pool alive until the buffer is returned to it
+	shared_ptr<FrameBufferPool> pool = shared_from_this();
+	return FrameBufferHandle(buffer, [pool, pixelCount](uint32_t* buffer) { pool->Release(buffer, pixelCount); });
+}
+
+void FrameBufferPool::Release(uint32_t* buffer, uint32_t size)
+{
+	auto lock = _lock.AcquireSafe();
+	if(size == _bufferSize && _freeBuffers.size() < FrameBufferPool::MaxFreeBuffers) {
+		_freeBuffers.push_back(buffer);
+	} else {
+		delete[] buffer;
+	}
+}
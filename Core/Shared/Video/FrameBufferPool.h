@@ -0,0 +1,29 @@
+#pragma once
+#include "pch.h"
+#include "Utilities/SimpleLock.h"
+
+//Reference counted handle to a frame buffer - the buffer goes back to its pool when the last handle is released
+typedef shared_ptr<uint32_t> FrameBufferHandle;
+
+//Recycles ARGB frame buffers so finished frames can be passed from the video filters to the renderer
+//(and kept alive there) by handle, without copying them, and without allocating a new buffer for each frame.
+class FrameBufferPool : public std::enable_shared_from_this<FrameBufferPool>
+{
+private:
+	//Enough to cover the filter's current frame, the renderer's pending & displayed frames and a spare one
+	static constexpr uint32_t MaxFreeBuffers = 4;
+
+	SimpleLock _lock;
+	vector<uint32_t*> _freeBuffers;
+	uint32_t _bufferSize = 0;
+
+	void Release(uint32_t* buffer, uint32_t size);
+
+public:
+	~FrameBufferPool();
+
+	static shared_ptr<FrameBufferPool> Create() { return std::make_shared<FrameBufferPool>(); }
+
+	//Returns a buffer that isn't referenced anywhere else - its content is undefined unless it was just allocated (zero-filled)
+	FrameBufferHandle Acquire(uint32_t pixelCount);
+};
@@ -4,26 +4,20 @@
 RotateFilter::RotateFilter(uint32_t angle)
 {
 	_angle = angle;
+	_bufferPool = FrameBufferPool::Create();
 }
 
 RotateFilter::~RotateFilter()
 {
-	if(_outputBuffer) {
-		delete[] _outputBuffer;
-	}
 }
 
 void RotateFilter::UpdateOutputBuffer(uint32_t width, uint32_t height)
 {
-	if(!_outputBuffer || width != _width || height != _height) {
-		if(_outputBuffer) {
-			delete[] _outputBuffer;
-		}
-
-		_width = width;
-		_height = height;
-		_outputBuffer = new uint32_t[_width * _height];
-	}
+	//Use a new buffer for every frame - the previous frame's buffer may still be in use by the renderer
+	_width = width;
+	_height = height;
+	_outputHandle = _bufferPool->Acquire(_width * _height);
+	_outputBuffer = _outputHandle.get();
 }
 
 uint32_t RotateFilter::GetAngle()
@@ -1,10 +1,13 @@
 #pragma once
 #include "pch.h"
 #include "Shared/SettingTypes.h"
+#include "Shared/Video/FrameBufferPool.h"
 
 class RotateFilter
 {
 private:
+	shared_ptr<FrameBufferPool> _bufferPool;
+	FrameBufferHandle _outputHandle;
 	uint32_t* _outputBuffer = nullptr;
 	uint32_t _angle = 0;
 	uint32_t _width = 0;
@@ -18,5 +21,6 @@ public:
 
 	uint32_t GetAngle();
 	uint32_t* ApplyFilter(uint32_t* inputArgbBuffer, uint32_t width, uint32_t height);
+	FrameBufferHandle GetOutputBufferHandle() { return _outputHandle; }
 	FrameInfo GetFrameInfo(FrameInfo baseFrameInfo);
 };
\ No newline at end of file
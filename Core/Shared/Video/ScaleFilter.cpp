@@ -11,6 +11,7 @@ ScaleFilter::ScaleFilter(ScaleFilterType scaleFilterType, uint32_t scale)
 {
 	_scaleFilterType = scaleFilterType;
 	_filterScale = scale;
+	_bufferPool = FrameBufferPool::Create();
 
 	if(!_hqxInitDone && _scaleFilterType == ScaleFilterType::HQX) {
 		hqxInit();
@@ -20,7 +21,6 @@ ScaleFilter::ScaleFilter(ScaleFilterType scaleFilterType, uint32_t scale)
 
 ScaleFilter::~ScaleFilter()
 {
-	delete[] _outputBuffer;
 }
 
 uint32_t ScaleFilter::GetScale()
@@ -48,12 +48,11 @@ void ScaleFilter::ApplyPrescaleFilter(uint32_t *inputArgbBuffer)
 
 void ScaleFilter::UpdateOutputBuffer(uint32_t width, uint32_t height)
 {
-	if(!_outputBuffer || width != _width || height != _height) {
-		delete[] _outputBuffer;
-		_width = width;
-		_height = height;
-		_outputBuffer = new uint32_t[_width*_height*_filterScale*_filterScale];
-	}
+	//Use a new buffer for every frame - the previous frame's buffer may still be in use by the renderer
+	_width = width;
+	_height = height;
+	_outputHandle = _bufferPool->Acquire(_width*_height*_filterScale*_filterScale);
+	_outputBuffer = _outputHandle.get();
 }
 
 uint32_t* ScaleFilter::ApplyFilter(uint32_t *inputArgbBuffer, uint32_t width, uint32_t height)
@@ -2,6 +2,7 @@
 
 #include "pch.h"
 #include "Shared/SettingTypes.h"
+#include "Shared/Video/FrameBufferPool.h"
 
 class ScaleFilter
 {
@@ -9,6 +10,8 @@ private:
 	static bool _hqxInitDone;
 	uint32_t _filterScale;
 	ScaleFilterType _scaleFilterType;
+	shared_ptr<FrameBufferPool> _bufferPool;
+	FrameBufferHandle _outputHandle;
 	uint32_t *_outputBuffer = nullptr;
 	uint32_t _width = 0;
 	uint32_t _height = 0;
@@ -22,6 +25,7 @@ public:
 
 	uint32_t GetScale();
 	uint32_t* ApplyFilter(uint32_t *inputArgbBuffer, uint32_t width, uint32_t height);
+	FrameBufferHandle GetOutputBufferHandle() { return _outputHandle; }
 	FrameInfo GetFrameInfo(FrameInfo baseFrameInfo);
 
 	static unique_ptr<ScaleFilter> GetScaleFilter(VideoFilterType filter);
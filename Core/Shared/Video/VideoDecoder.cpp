@@ -15,6 +15,7 @@
 #include "Shared/InputHud.h"
 #include "Shared/RenderedFrame.h"
 #include "Shared/Video/SystemHud.h"
+#include "Shared/PerformanceCounters.h"
 #include "SNES/CartTypes.h"
 
 VideoDecoder::VideoDecoder(Emulator* emu)
@@ -94,6 +95,9 @@ void VideoDecoder::DecodeFrame(bool forRewind)
 {
 	UpdateVideoFilter();
 
+	PerformanceCounters* perfCounters = _emu->GetPerformanceCounters();
+	uint64_t startTime = PerformanceCounters::GetTimestamp();
+
 	bool isAudioPlayer = _emu->GetAudioPlayerHud() != nullptr;
 	if(isAudioPlayer) {
 		//When an audio file is loaded, force base resolution to 256x240 for all consoles
@@ -107,12 +111,14 @@ void VideoDecoder::DecodeFrame(bool forRewind)
 	_videoFilter->SetBaseFrameInfo(_baseFrameSize);
 	FrameInfo frameSize = _videoFilter->SendFrame((uint16_t*)_frame.FrameBuffer, _frame.FrameNumber, _frame.VideoPhase, _frame.Data);
 
-	uint32_t* outputBuffer = _videoFilter->GetOutputBuffer();
+	FrameBufferHandle outputHandle = _videoFilter->GetOutputBufferHandle();
+	uint32_t* outputBuffer = outputHandle.get();
 	
 	OverscanDimensions overscan = _videoFilter->GetOverscan();
 
 	if(_rotateFilter && !isAudioPlayer) {
 		outputBuffer = _rotateFilter->ApplyFilter(outputBuffer, frameSize.Width, frameSize.Height);
+		outputHandle = _rotateFilter->GetOutputBufferHandle();
 		if((_rotateFilter->GetAngle() % 180) != 0) {
 			//90 or 270 rotation, swap height & width
 			std::swap(_baseFrameSize.Width, _baseFrameSize.Height);
@@ -122,8 +128,12 @@ void VideoDecoder::DecodeFrame(bool forRewind)
 
 	_emu->GetDebugHud()->Draw(outputBuffer, frameSize, overscan, _frame.FrameNumber, _videoFilter->GetScaleFactor());
 
+	perfCounters->AddSample(PerfStage::VideoFilter, startTime);
+	startTime = PerformanceCounters::GetTimestamp();
+
 	if(_scaleFilter && !isAudioPlayer) {
 		outputBuffer = _scaleFilter->ApplyFilter(outputBuffer, frameSize.Width, frameSize.Height);
+		outputHandle = _scaleFilter->GetOutputBufferHandle();
 		frameSize = _scaleFilter->GetFrameInfo(frameSize);
 	}
 
@@ -132,7 +142,10 @@ void VideoDecoder::DecodeFrame(bool forRewind)
 		ScanlineFilter::ApplyFilter(outputBuffer, frameSize.Width, frameSize.Height, _emu->GetSettings()->GetVideoConfig().ScanlineIntensity, scale);
 	}
 
+	perfCounters->AddSample(PerfStage::ScaleFilter, startTime);
+
 	RenderedFrame convertedFrame((void*)outputBuffer, frameSize.Width, frameSize.Height, _frame.Scale, _frame.FrameNumber, _frame.InputData);
+	convertedFrame.BufferHandle = outputHandle;
 
 	double aspectRatio = _emu->GetSettings()->GetAspectRatio(_emu->GetRegion(), _baseFrameSize);
 	if(frameSize.Height != _lastFrameSize.Height || frameSize.Width != _lastFrameSize.Width || aspectRatio != _lastAspectRatio) {
@@ -178,7 +191,7 @@ void VideoDecoder::WaitForAsyncFrameDecode()
 
 void VideoDecoder::UpdateFrame(RenderedFrame frame, bool sync, bool forRewind)
 {
-	if(_emu->IsRunAheadFrame()) {
+	if(_emu->IsRunAheadFrame() || _emu->GetSettings()->CheckFlag(EmulationFlags::AudioOnly)) {
 		return;
 	}
 
@@ -8,6 +8,7 @@
 #include "Shared/Video/SystemHud.h"
 #include "Shared/InputHud.h"
 #include "Shared/MessageManager.h"
+#include "Shared/PerformanceCounters.h"
 #include "Utilities/Video/IVideoRecorder.h"
 #include "Utilities/Video/AviRecorder.h"
 #include "Utilities/Video/GifRecorder.h"
@@ -91,6 +92,7 @@ void VideoRenderer::RenderThread()
 				frame = _lastFrame;
 			}
 
+			uint64_t hudStartTime = PerformanceCounters::GetTimestamp();
 			_inputHud->DrawControllers(size, frame.InputData);
 			{
 				auto lock = _hudLock.AcquireSafe();
@@ -99,9 +101,11 @@ void VideoRenderer::RenderThread()
 			
 			_emuHudSurface.IsDirty = _rendererHud->Draw(_emuHudSurface.Buffer, size, {}, 0, {}, true);
 			_scriptHudSurface.IsDirty = DrawScriptHud(frame);
+			_emu->GetPerformanceCounters()->AddSample(PerfStage::Hud, hudStartTime);
 
 			if(forceRender || _needRedraw || _emuHudSurface.IsDirty || _scriptHudSurface.IsDirty) {
 				_needRedraw = false;
+				PerfTimer timer(_emu->GetPerformanceCounters(), PerfStage::Render);
 				_renderer->Render(_emuHudSurface, _scriptHudSurface);
 			}
 		}
@@ -174,7 +178,10 @@ void VideoRenderer::UpdateFrame(RenderedFrame& frame)
 	}
 
 	if(_renderer) {
-		_renderer->UpdateFrame(frame);
+		{
+			PerfTimer timer(_emu->GetPerformanceCounters(), PerfStage::RendererUpload);
+			_renderer->UpdateFrame(frame);
+		}
 		_needRedraw = true;
 		_waitForRender.Signal();
 	}
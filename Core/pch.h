@@ -63,6 +63,7 @@ using std::ostream;
 using std::stringstream;
 using utf8::ifstream;
 using utf8::ofstream;
+using utf8::fstream;
 using std::list;
 using std::max;
 using std::string;
@@ -105,6 +105,7 @@ extern "C"
 	}
 
 	DllExport void __stdcall ResetProfiler(CpuType cpuType) { WithToolVoid(GetCallstackManager(cpuType), GetProfiler()->Reset()); }
+	DllExport bool __stdcall ExportProfilerFoldedStacks(CpuType cpuType, char* filename) { return WithTool(bool, GetCallstackManager(cpuType), GetProfiler()->ExportFoldedStacks(filename)); }
 
 	DllExport void __stdcall GetConsoleState(BaseState& state, ConsoleType consoleType) { WithDebugger(void, GetConsoleState(state, consoleType)); }
 	DllExport void __stdcall GetCpuState(BaseState& state, CpuType cpuType) { WithDebugger(void, GetCpuState(state, cpuType)); }
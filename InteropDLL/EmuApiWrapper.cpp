@@ -10,6 +10,7 @@
 #include "Core/Shared/KeyManager.h"
 #include "Core/Shared/ShortcutKeyHandler.h"
 #include "Core/Shared/TimingInfo.h"
+#include "Core/Shared/PerformanceCounters.h"
 #include "Core/Shared/CheatManager.h"
 #include "Core/Shared/DebuggerRequest.h"
 #include "Core/Netplay/GameClient.h"
@@ -161,6 +162,10 @@ extern "C" {
 		return _emu->GetTimingInfo(cpuType);
 	}
 
+	DllExport void __stdcall GetPerformanceCounters(PerfStageStats stats[]) { _emu->GetPerformanceCounters()->GetStats(stats); }
+	DllExport void __stdcall ResetPerformanceCounters() { _emu->GetPerformanceCounters()->Reset(); }
+	DllExport bool __stdcall ExportPerformanceCounters(char* filename) { return _emu->GetPerformanceCounters()->ExportCsv(filename); }
+
 	DllExport void __stdcall TakeScreenshot() { _emu->GetVideoDecoder()->TakeScreenshot(); }
 
 	DllExport void __stdcall ProcessAudioPlayerAction(AudioPlayerActionParams p) { _emu->ProcessAudioPlayerAction(p); }
@@ -4,6 +4,7 @@
 #include "Core/Netplay/ClientConnectionData.h"
 #include "Core/Netplay/GameServer.h"
 #include "Core/Netplay/GameClient.h"
+#include "Core/Netplay/SpectatorRelay.h"
 
 extern unique_ptr<Emulator> _emu;
 
@@ -21,6 +22,16 @@ extern "C" {
 	DllExport void __stdcall Disconnect() { _emu->GetGameClient()->Disconnect(); }
 	DllExport bool __stdcall IsConnected() { return _emu->GetGameClient()->Connected(); }
 
+	DllExport bool __stdcall StartSpectatorRelay(char* host, uint16_t hostPort, char* hostPassword, uint16_t relayPort, char* relayPassword)
+	{
+		ClientConnectionData connectionData(host, hostPort, hostPassword, true);
+		return _emu->GetSpectatorRelay()->StartRelay(connectionData, relayPort, relayPassword);
+	}
+
+	DllExport void __stdcall StopSpectatorRelay() { _emu->GetSpectatorRelay()->StopRelay(); }
+	DllExport bool __stdcall IsSpectatorRelayRunning() { return _emu->GetSpectatorRelay()->Started(); }
+	DllExport uint32_t __stdcall GetSpectatorRelayClientCount() { return _emu->GetSpectatorRelay()->GetSpectatorCount(); }
+
 	DllExport void __stdcall NetPlayGetControllerList(NetplayControllerUsageInfo* list, int32_t& length)
 	{
 		vector<NetplayControllerUsageInfo> controllers;
@@ -2,6 +2,7 @@
 #include "Core/Shared/Emulator.h"
 #include "Core/Shared/Video/VideoRenderer.h"
 #include "Core/Shared/Audio/SoundMixer.h"
+#include "Core/Shared/Audio/AudioTrackRenderer.h"
 #include "Core/Shared/Movies/MovieManager.h"
 
 extern unique_ptr<Emulator> _emu;
@@ -15,6 +16,7 @@ extern "C"
 	DllExport void __stdcall WaveRecord(char* filename) { _emu->GetSoundMixer()->StartRecording(filename); }
 	DllExport void __stdcall WaveStop() { _emu->GetSoundMixer()->StopRecording(); }
 	DllExport bool __stdcall WaveIsRecording() { return _emu->GetSoundMixer()->IsRecording(); }
+	DllExport int32_t __stdcall WaveRenderTracks(char* filename, char* outputFolder, uint32_t threadCount, bool rawPcm) { return AudioTrackRenderer::RenderTracks(_emu->GetSettings(), filename, outputFolder, threadCount, rawPcm); }
 
 	DllExport void __stdcall MoviePlay(char* filename) { _emu->GetMovieManager()->Play(string(filename)); }
 	DllExport void __stdcall MovieStop() { _emu->GetMovieManager()->Stop(); }
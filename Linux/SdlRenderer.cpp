@@ -12,7 +12,7 @@ SimpleLock SdlRenderer::_frameLock;
 SdlRenderer::SdlRenderer(Emulator* emu, void* windowHandle) : _windowHandle(windowHandle)
 {
 	_emu = emu;
-	_frameBuffer = nullptr;
+	_bufferPool = FrameBufferPool::Create();
 	_requiredWidth = 256;
 	_requiredHeight = 240;
 	
@@ -24,7 +24,7 @@ SdlRenderer::~SdlRenderer()
 	_emu->GetVideoRenderer()->UnregisterRenderingDevice(this);
 
 	Cleanup();
-	delete[] _frameBuffer;	
+	_frameBuffer.reset();
 }
 
 void SdlRenderer::LogSdlError(const char* msg)
@@ -153,24 +153,27 @@ void SdlRenderer::ClearFrame()
 		return;
 	}
 
-	memset(_frameBuffer, 0, _requiredWidth * _requiredHeight * _bytesPerPixel);
+	//The current buffer may be shared with the video filters, clear a buffer of our own instead
+	_frameBuffer = _bufferPool->Acquire(_requiredWidth * _requiredHeight);
+	memset(_frameBuffer.get(), 0, _requiredWidth * _requiredHeight * _bytesPerPixel);
 	_frameChanged = true;
 }
 
 void SdlRenderer::UpdateFrame(RenderedFrame& frame)
 {
 	auto lock = _frameLock.AcquireSafe();
-	if(_frameBuffer == nullptr || _requiredWidth != frame.Width || _requiredHeight != frame.Height) {
-		_requiredWidth = frame.Width;
-		_requiredHeight = frame.Height;
-		
-		delete[] _frameBuffer;
-		_frameBuffer = new uint32_t[frame.Width*frame.Height];
-		memset(_frameBuffer, 0, frame.Width * frame.Height *4);
+	_requiredWidth = frame.Width;
+	_requiredHeight = frame.Height;
+
+	if(frame.BufferHandle) {
+		//Pooled frame, keep a reference to it until the next frame - it is copied directly into the texture when rendering
+		_frameBuffer = frame.BufferHandle;
+	} else {
+		//The frame's buffer isn't guaranteed to stay valid after this call, copy it
+		_frameBuffer = _bufferPool->Acquire(frame.Width * frame.Height);
+		memcpy(_frameBuffer.get(), frame.FrameBuffer, frame.Width * frame.Height *_bytesPerPixel);
 	}
-	
-	memcpy(_frameBuffer, frame.FrameBuffer, frame.Width * frame.Height *_bytesPerPixel);
-	_frameChanged = true;	
+	_frameChanged = true;
 }
 
 bool SdlRenderer::UpdateHudSize(HudRenderInfo& hud, uint32_t width, uint32_t height)
@@ -224,7 +227,7 @@ void SdlRenderer::Render(RenderSurfaceInfo& emuHud, RenderSurfaceInfo& scriptHud
 	if(SDL_LockTexture(_sdlTexture, nullptr, (void**)&textureBuffer, &rowPitch) == 0) {
 		auto frameLock = _frameLock.AcquireSafe();
 		if(_frameBuffer && _frameWidth == _requiredWidth && _frameHeight == _requiredHeight) {
-			uint32_t* ppuFrameBuffer = _frameBuffer;
+			uint32_t* ppuFrameBuffer = _frameBuffer.get();
 			if(rowPitch != _frameWidth) {
 				for(uint32_t i = 0, iMax = _frameHeight; i < iMax; i++) {
 					memcpy(textureBuffer, ppuFrameBuffer, _frameWidth*_bytesPerPixel);
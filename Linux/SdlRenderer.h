@@ -4,6 +4,7 @@
 #include "Utilities/SimpleLock.h"
 #include "Core/Shared/Video/VideoRenderer.h"
 #include "Core/Shared/RenderedFrame.h"
+#include "Core/Shared/Video/FrameBufferPool.h"
 
 class Emulator;
 
@@ -30,7 +31,8 @@ private:
 	bool _useBilinearInterpolation = false;
 
 	static SimpleLock _frameLock;
-	uint32_t* _frameBuffer = nullptr;
+	FrameBufferHandle _frameBuffer;
+	shared_ptr<FrameBufferPool> _bufferPool;
 
 	const uint32_t _bytesPerPixel = 4;
 	uint32_t _screenBufferSize = 0;
@@ -17,6 +17,8 @@ namespace Mesen.Config
 		[Reactive] [MinMax(0, 5000)] public UInt32 RewindSpeed { get; set; } = 100;
 
 		[Reactive] [MinMax(0, 10)] public UInt32 RunAheadFrames { get; set; } = 0;
+		[Reactive] public bool JustInTimeInputPolling { get; set; } = false;
+		[Reactive] public bool AdaptiveFrameDelay { get; set; } = false;
 		
 		public void ApplyConfig()
 		{
@@ -24,7 +26,9 @@ namespace Mesen.Config
 				EmulationSpeed = this.EmulationSpeed,
 				TurboSpeed = this.TurboSpeed,
 				RewindSpeed = this.RewindSpeed,
-				RunAheadFrames = this.RunAheadFrames
+				RunAheadFrames = this.RunAheadFrames,
+				JustInTimeInputPolling = this.JustInTimeInputPolling,
+				AdaptiveFrameDelay = this.AdaptiveFrameDelay
 			});
 		}
 	}
@@ -37,6 +41,8 @@ namespace Mesen.Config
 		public UInt32 RewindSpeed;
 
 		public UInt32 RunAheadFrames;
+		[MarshalAs(UnmanagedType.I1)] public bool JustInTimeInputPolling;
+		[MarshalAs(UnmanagedType.I1)] public bool AdaptiveFrameDelay;
 	}
 
 	public enum ConsoleRegion
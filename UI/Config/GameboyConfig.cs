@@ -15,6 +15,7 @@ namespace Mesen.Config
 
 		[Reactive] public GameboyModel Model { get; set; } = GameboyModel.AutoFavorGbc;
 		[Reactive] public bool UseSgb2 { get; set; } = true;
+		[Reactive] public bool RunSgbOnSeparateThread { get; set; } = false;
 
 		[Reactive] public bool BlendFrames { get; set; } = true;
 		[Reactive] public bool GbcAdjustColors { get; set; } = true;
@@ -41,6 +42,7 @@ namespace Mesen.Config
 				Controller = Controller.ToInterop(),
 				Model = Model,
 				UseSgb2 = UseSgb2,
+				RunSgbOnSeparateThread = RunSgbOnSeparateThread,
 
 				BlendFrames = BlendFrames,
 				GbcAdjustColors = GbcAdjustColors,
@@ -110,6 +112,7 @@ namespace Mesen.Config
 
 		public GameboyModel Model;
 		[MarshalAs(UnmanagedType.I1)] public bool UseSgb2;
+		[MarshalAs(UnmanagedType.I1)] public bool RunSgbOnSeparateThread;
 
 		[MarshalAs(UnmanagedType.I1)] public bool BlendFrames;
 		[MarshalAs(UnmanagedType.I1)] public bool GbcAdjustColors;
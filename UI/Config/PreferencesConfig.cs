@@ -51,6 +51,8 @@ namespace Mesen.Config
 
 		[Reactive] public bool EnableRewind { get; set; } = true;
 		[Reactive] public UInt32 RewindBufferSize { get; set; } = 300;
+		[Reactive] public bool EnableRewindDiskHistory { get; set; } = false;
+		[Reactive] public UInt32 RewindDiskBufferSize { get; set; } = 4000;
 
 		[Reactive] public bool AlwaysOnTop { get; set; } = false;
 
@@ -234,6 +236,7 @@ namespace Mesen.Config
 				SaveStateFolderOverride = OverrideSaveStateFolder ? SaveStateFolder : "",
 				ScreenshotFolderOverride = OverrideScreenshotFolder ? ScreenshotFolder : "",
 				RewindBufferSize = EnableRewind ? RewindBufferSize : 0,
+				RewindDiskBufferSize = EnableRewind && EnableRewindDiskHistory ? RewindDiskBufferSize : 0,
 				AutoSaveStateDelay = EnableAutoSaveState ? AutoSaveStateDelay : 0
 			});
 		}
@@ -283,6 +286,7 @@ namespace Mesen.Config
 
 		public UInt32 AutoSaveStateDelay;
 		public UInt32 RewindBufferSize;
+		public UInt32 RewindDiskBufferSize;
 
 		public string SaveFolderOverride;
 		public string SaveStateFolderOverride;
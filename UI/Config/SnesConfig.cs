@@ -54,6 +54,8 @@ namespace Mesen.Config
 		//Emulation
 		[Reactive] public bool EnableRandomPowerOnState { get; set; } = false;
 		[Reactive] public bool EnableStrictBoardMappings { get; set; } = false;
+		[Reactive] public bool RunSpcOnSeparateThread { get; set; } = false;
+		[Reactive] public bool RunPpuCompositingOnSeparateThread { get; set; } = false;
 		[Reactive] public RamState RamPowerOnState { get; set; } = RamState.Random;
 		[Reactive] [MinMax(-999, 999)] public Int32 SpcClockSpeedAdjustment { get; set; } = 40;
 
@@ -109,6 +111,8 @@ namespace Mesen.Config
 
 				EnableRandomPowerOnState = this.EnableRandomPowerOnState,
 				EnableStrictBoardMappings = this.EnableStrictBoardMappings,
+				RunSpcOnSeparateThread = this.RunSpcOnSeparateThread,
+				RunPpuCompositingOnSeparateThread = this.RunPpuCompositingOnSeparateThread,
 				PpuExtraScanlinesBeforeNmi = this.PpuExtraScanlinesBeforeNmi,
 				PpuExtraScanlinesAfterNmi = this.PpuExtraScanlinesAfterNmi,
 				GsuClockSpeed = this.GsuClockSpeed,
@@ -200,6 +204,8 @@ namespace Mesen.Config
 
 		[MarshalAs(UnmanagedType.I1)] public bool EnableRandomPowerOnState;
 		[MarshalAs(UnmanagedType.I1)] public bool EnableStrictBoardMappings;
+		[MarshalAs(UnmanagedType.I1)] public bool RunSpcOnSeparateThread;
+		[MarshalAs(UnmanagedType.I1)] public bool RunPpuCompositingOnSeparateThread;
 		public RamState RamPowerOnState;
 		public Int32 SpcClockSpeedAdjustment;
 
@@ -29,9 +29,27 @@ namespace Mesen.Debugger.Utilities
 			T wnd = createWindow();
 			wnd.Closed += OnClosedHandler;
 			_openedWindows.TryAdd(wnd, true);
+			UpdateToolFlags();
 			return wnd;
 		}
 
+		private static void UpdateToolFlags()
+		{
+			//Let the core skip the access counters and event logging when no opened window uses them
+			bool accessCounters = false;
+			bool eventViewer = false;
+			foreach(Window wnd in _openedWindows.Keys) {
+				if(wnd is DebuggerWindow || wnd is MemoryToolsWindow || wnd is MemorySearchWindow || wnd is TilemapViewerWindow || wnd is DebugLogWindow) {
+					accessCounters = true;
+				} else if(wnd is EventViewerWindow) {
+					eventViewer = true;
+				}
+			}
+
+			ConfigApi.SetDebuggerFlag(DebuggerFlags.AccessCountersEnabled, accessCounters);
+			ConfigApi.SetDebuggerFlag(DebuggerFlags.EventViewerEnabled, eventViewer);
+		}
+
 		private static void OnClosedHandler(object? sender, EventArgs e)
 		{
 			if(sender is Window window) {
@@ -76,6 +94,7 @@ namespace Mesen.Debugger.Utilities
 		{
 			//Remove window from list first, to ensure no more notifications are sent to it
 			_openedWindows.TryRemove(wnd, out _);
+			UpdateToolFlags();
 
 			if(Interlocked.Decrement(ref _debugWindowCounter) == 0) {
 				//Closed the last debug window, save the workspace and turn off the debugger
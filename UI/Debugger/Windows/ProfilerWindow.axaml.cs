@@ -8,7 +8,10 @@ using DataBoxControl;
 using Mesen.Debugger.Controls;
 using Mesen.Debugger.Utilities;
 using Mesen.Debugger.ViewModels;
+using Mesen.Config;
 using Mesen.Interop;
+using Mesen.Localization;
+using Mesen.Utilities;
 using System;
 using System.ComponentModel;
 
@@ -84,6 +87,20 @@ namespace Mesen.Debugger.Windows
 			_model.SelectedTab?.ResetData();
 		}
 
+		private async void OnExportClick(object sender, RoutedEventArgs e)
+		{
+			if(_model.SelectedTab == null) {
+				return;
+			}
+
+			CpuType cpuType = _model.SelectedTab.CpuType;
+			string initialFile = EmuApi.GetRomInfo().GetRomName() + " - " + ResourceHelper.GetEnumText(cpuType) + ".folded.txt";
+			string? filename = await FileDialogHelper.SaveFile(ConfigManager.DebuggerFolder, initialFile, VisualRoot, FileDialogHelper.TraceExt);
+			if(filename != null) {
+				DebugApi.ExportProfilerFoldedStacks(cpuType, filename);
+			}
+		}
+
 		private void InitializeComponent()
 		{
 			AvaloniaXamlLoader.Load(this);
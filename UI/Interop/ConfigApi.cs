@@ -54,6 +54,7 @@ namespace Mesen.Interop
 		MaximumSpeed = 0x04,
 		InBackground = 0x08,
 		ConsoleMode = 0x10,
+		AudioOnly = 0x20,
 	}
 
 	public enum DebuggerFlags : UInt32
@@ -68,6 +69,9 @@ namespace Mesen.Interop
 		NesDebuggerEnabled = (1 << 7),
 		PceDebuggerEnabled = (1 << 8),
 		SmsDebuggerEnabled = (1 << 9),
+
+		AccessCountersEnabled = (1 << 10),
+		EventViewerEnabled = (1 << 11),
 	}
 
 	public struct InteropShortcutKeyInfo
@@ -423,6 +423,7 @@ namespace Mesen.Interop
 		}
 
 		[DllImport(DllPath)] public static extern void ResetProfiler(CpuType type);
+		[DllImport(DllPath)][return: MarshalAs(UnmanagedType.I1)] public static extern bool ExportProfilerFoldedStacks(CpuType type, [MarshalAs(UnmanagedType.LPUTF8Str)] string filename);
 		[DllImport(DllPath, EntryPoint = "GetProfilerData")] private static extern void GetProfilerDataWrapper(CpuType type, IntPtr profilerData, ref UInt32 functionCount);
 		public static unsafe int GetProfilerData(CpuType type, ref ProfiledFunction[] profilerData)
 		{
@@ -82,6 +82,17 @@ namespace Mesen.Interop
 
 		[DllImport(DllPath)] public static extern TimingInfo GetTimingInfo(CpuType cpuType);
 
+		[DllImport(DllPath, EntryPoint = "GetPerformanceCounters")] private static extern void GetPerformanceCountersWrapper([In, Out] PerfStageStats[] stats);
+		public static PerfStageStats[] GetPerformanceCounters()
+		{
+			PerfStageStats[] stats = new PerfStageStats[(int)PerfStage.StageCount];
+			GetPerformanceCountersWrapper(stats);
+			return stats;
+		}
+
+		[DllImport(DllPath)] public static extern void ResetPerformanceCounters();
+		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool ExportPerformanceCounters([MarshalAs(UnmanagedType.LPUTF8Str)]string filename);
+
 		[DllImport(DllPath)] public static extern double GetAspectRatio();
 		[DllImport(DllPath)] public static extern FrameInfo GetBaseScreenSize();
 		[DllImport(DllPath)] public static extern Int32 GetGameMemorySize(MemoryType type);
@@ -145,6 +156,31 @@ namespace Mesen.Interop
 		public UInt32 CycleCount;
 	}
 
+	public enum PerfStage
+	{
+		Emulation,
+		AudioMixing,
+		AudioEffects,
+		AudioOutput,
+		VideoFilter,
+		ScaleFilter,
+		Hud,
+		RendererUpload,
+		Render,
+		FrameLimiter,
+		StageCount
+	}
+
+	public struct PerfStageStats
+	{
+		public UInt64 SampleCount;
+		public double Last;
+		public double Average;
+		public double P50;
+		public double P99;
+		public double Max;
+	}
+
 	public struct FrameInfo
 	{
 		public UInt32 Width;
@@ -16,6 +16,11 @@ namespace Mesen.Interop
 		[DllImport(DllPath)] public static extern void Disconnect();
 		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool IsConnected();
 
+		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool StartSpectatorRelay([MarshalAs(UnmanagedType.LPUTF8Str)]string host, UInt16 hostPort, [MarshalAs(UnmanagedType.LPUTF8Str)]string hostPassword, UInt16 relayPort, [MarshalAs(UnmanagedType.LPUTF8Str)]string relayPassword);
+		[DllImport(DllPath)] public static extern void StopSpectatorRelay();
+		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool IsSpectatorRelayRunning();
+		[DllImport(DllPath)] public static extern UInt32 GetSpectatorRelayClientCount();
+
 		[DllImport(DllPath)] private static extern void NetPlayGetControllerList([In,Out] NetplayControllerUsageInfo[] controllers, ref Int32 length);
 		public static NetplayControllerUsageInfo[] NetPlayGetControllerList()
 		{
@@ -19,6 +19,7 @@ namespace Mesen.Interop
 		[DllImport(DllPath)] public static extern void WaveRecord([MarshalAs(UnmanagedType.LPUTF8Str)]string filename);
 		[DllImport(DllPath)] public static extern void WaveStop();
 		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool WaveIsRecording();
+		[DllImport(DllPath)] public static extern Int32 WaveRenderTracks([MarshalAs(UnmanagedType.LPUTF8Str)]string filename, [MarshalAs(UnmanagedType.LPUTF8Str)]string outputFolder, UInt32 threadCount, [MarshalAs(UnmanagedType.I1)]bool rawPcm);
 
 		[DllImport(DllPath)] public static extern void MoviePlay([MarshalAs(UnmanagedType.LPUTF8Str)]string filename);
 		[DllImport(DllPath)] public static extern void MovieRecord(RecordMovieOptions options);
@@ -75,6 +75,14 @@ namespace Mesen
 				return TestRunner.Run(args);
 			}
 
+			if(CommandLineHelper.IsSpectatorRelay(args)) {
+				return SpectatorRelayRunner.Run(args);
+			}
+
+			if(CommandLineHelper.IsAudioRenderer(args)) {
+				return AudioRenderRunner.Run(args);
+			}
+
 			using SingleInstance instance = SingleInstance.Instance;
 			instance.Init(args);
 			if(instance.FirstInstance) {
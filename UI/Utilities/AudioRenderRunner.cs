@@ -0,0 +1,71 @@
+﻿using Mesen.Config;
+using Mesen.Interop;
+using System;
+using System.Collections.Generic;
+using System.IO;
+
+namespace Mesen.Utilities
+{
+	internal class AudioRenderRunner
+	{
+		internal static int Run(string[] args)
+		{
+			ConfigManager.DisableSaveSettings = true;
+
+			List<string> files = new();
+			string outputFolder = ConfigManager.WaveFolder;
+			UInt32 threadCount = (UInt32)Environment.ProcessorCount;
+			bool rawPcm = false;
+
+			foreach(string arg in args) {
+				string absPath = Path.IsPathRooted(arg) ? arg : Path.GetFullPath(arg, Program.OriginalFolder);
+				if(File.Exists(absPath)) {
+					files.Add(absPath);
+					continue;
+				}
+
+				string[] values = arg.TrimStart('-', '/').Split('=', 2);
+				switch(values[0].ToLowerInvariant()) {
+					case "rawpcm": rawPcm = true; break;
+
+					case "outputfolder":
+						if(values.Length == 2) {
+							outputFolder = Path.IsPathRooted(values[1]) ? values[1] : Path.GetFullPath(values[1], Program.OriginalFolder);
+						}
+						break;
+
+					case "threads":
+						if(values.Length == 2 && UInt32.TryParse(values[1], out UInt32 count) && count > 0) {
+							threadCount = count;
+						}
+						break;
+				}
+			}
+
+			if(files.Count == 0) {
+				//No file specified
+				return -1;
+			}
+
+			EmuApi.InitDll();
+			ConfigManager.Config.ApplyConfig();
+
+			//Each track is rendered by its own emulator instance, the main instance is only used for its settings
+			EmuApi.InitializeEmu(ConfigManager.HomeFolder, IntPtr.Zero, IntPtr.Zero, true, true, true, true);
+
+			int result = 0;
+			foreach(string file in files) {
+				int trackCount = RecordApi.WaveRenderTracks(file, outputFolder, threadCount, rawPcm);
+				if(trackCount < 0) {
+					Console.WriteLine($"Could not render {file}");
+					result = -1;
+				} else {
+					Console.WriteLine($"Rendered {trackCount} track(s) from {file}");
+				}
+			}
+
+			EmuApi.Release();
+			return result;
+		}
+	}
+}
@@ -127,6 +127,16 @@ public class CommandLineHelper
 		return args.Any(arg => CommandLineHelper.ConvertArg(arg).ToLowerInvariant() == "testrunner");
 	}
 
+	public static bool IsSpectatorRelay(string[] args)
+	{
+		return args.Any(arg => CommandLineHelper.ConvertArg(arg).ToLowerInvariant().StartsWith("spectatorrelay="));
+	}
+
+	public static bool IsAudioRenderer(string[] args)
+	{
+		return args.Any(arg => CommandLineHelper.ConvertArg(arg).ToLowerInvariant() == "renderaudio");
+	}
+
 	public void ProcessPostLoadCommandSwitches(MainWindow wnd)
 	{
 		if(LuaScriptsToLoad.Count > 0) {
@@ -174,7 +184,9 @@ public class CommandLineHelper
 		string general = @"--fullscreen - Start in fullscreen mode
 --doNotSaveSettings - Prevent settings from being saved to the disk (useful to prevent command line options from becoming the default settings)
 --recordMovie=""filename.mmo"" - Start recording a movie after the specified game is loaded.
---loadLastSession - Resumes the game in the state it was left in when it was last played.";
+--loadLastSession - Resumes the game in the state it was left in when it was last played.
+--spectatorRelay=host:port - Runs a headless netplay relay that connects to the specified server and forwards its stream to spectators (use with --relayPort=port, --hostPassword=password and --relayPassword=password)
+--renderAudio ""file.nsf"" - Renders every track of the specified NSF/SPC/GBS/HES files to .wav files as fast as possible and exits (use with --outputFolder=path, --threads=count and --rawPcm)";
 
 		result["General"] = general;
 		result["Audio"] = GetSwichesForObject("audio.", typeof(AudioConfig));
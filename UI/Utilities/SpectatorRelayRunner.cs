@@ -0,0 +1,66 @@
+﻿using Mesen.Config;
+using Mesen.Interop;
+using System;
+using System.Linq;
+
+namespace Mesen.Utilities
+{
+	internal class SpectatorRelayRunner
+	{
+		internal static int Run(string[] args)
+		{
+			ConfigManager.DisableSaveSettings = true;
+
+			string host = "localhost";
+			UInt16 hostPort = 8888;
+			string hostPassword = "";
+			UInt16 relayPort = 8889;
+			string relayPassword = "";
+
+			foreach(string arg in args) {
+				string[] values = arg.TrimStart('-', '/').Split('=', 2);
+				if(values.Length != 2) {
+					continue;
+				}
+
+				switch(values[0].ToLowerInvariant()) {
+					case "spectatorrelay":
+						string[] hostValues = values[1].Split(':');
+						host = hostValues[0];
+						if(hostValues.Length > 1 && UInt16.TryParse(hostValues[1], out UInt16 port)) {
+							hostPort = port;
+						}
+						break;
+
+					case "relayport":
+						if(UInt16.TryParse(values[1], out UInt16 listenPort)) {
+							relayPort = listenPort;
+						}
+						break;
+
+					case "hostpassword": hostPassword = values[1]; break;
+					case "relaypassword": relayPassword = values[1]; break;
+				}
+			}
+
+			EmuApi.InitDll();
+			ConfigManager.Config.ApplyConfig();
+
+			//The relay never runs a game, no audio/video/input is needed
+			EmuApi.InitializeEmu(ConfigManager.HomeFolder, IntPtr.Zero, IntPtr.Zero, true, true, true, true);
+
+			int result = -1;
+			if(NetplayApi.StartSpectatorRelay(host, hostPort, hostPassword, relayPort, relayPassword)) {
+				Console.WriteLine($"Relaying {host}:{hostPort} on port {relayPort}");
+				while(NetplayApi.IsSpectatorRelayRunning()) {
+					System.Threading.Thread.Sleep(500);
+				}
+				result = 0;
+			}
+
+			NetplayApi.StopSpectatorRelay();
+			EmuApi.Release();
+			return result;
+		}
+	}
+}
@@ -1,15 +1,21 @@
 #include "pch.h"
 #include "CrossFeedFilter.h"
 
-void CrossFeedFilter::ApplyFilter(int16_t *stereoBuffer, size_t sampleCount, int ratio)
+void CrossFeedFilter::ApplyFilter(int16_t *stereoBuffer, size_t sampleCount, int ratio, int volume)
 {
-	for(size_t i = 0; i < sampleCount; i++) {
-		int16_t leftSample = stereoBuffer[0];
-		int16_t rightSample = stereoBuffer[1];
+	//2.14 fixed point factors (keeps the sums within 32 bits) - the loop only uses integer math and has no dependencies
+	//between samples, which lets the compiler vectorize it
+	int32_t directFactor = volume * 16384 / 100;
+	int32_t crossFactor = ratio * volume * 16384 / 10000;
 
-		stereoBuffer[0] += rightSample * ratio / 100;
-		stereoBuffer[1] += leftSample * ratio / 100;
+	for(size_t i = 0; i < sampleCount * 2; i += 2) {
+		int32_t left = stereoBuffer[i];
+		int32_t right = stereoBuffer[i + 1];
 
-		stereoBuffer += 2;
+		int32_t outLeft = (left * directFactor + right * crossFactor) >> 14;
+		int32_t outRight = (right * directFactor + left * crossFactor) >> 14;
+
+		stereoBuffer[i] = (int16_t)std::clamp(outLeft, (int32_t)INT16_MIN, (int32_t)INT16_MAX);
+		stereoBuffer[i + 1] = (int16_t)std::clamp(outRight, (int32_t)INT16_MIN, (int32_t)INT16_MAX);
 	}
 }
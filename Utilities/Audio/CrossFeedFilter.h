@@ -3,5 +3,6 @@
 class CrossFeedFilter
 {
 public:
-	void ApplyFilter(int16_t* stereoBuffer, size_t sampleCount, int ratio);
+	//Mixes each channel into the other (ratio, 0-100%) and applies the volume (0-100%) in a single pass
+	static void ApplyFilter(int16_t* stereoBuffer, size_t sampleCount, int ratio, int volume);
 };
\ No newline at end of file
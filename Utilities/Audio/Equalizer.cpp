@@ -2,44 +2,104 @@
 #include "Equalizer.h"
 #include "orfanidis_eq.h"
 
+double Equalizer::ProcessSample(SectionState* state, double in)
+{
+	alignas(32) double values[BandCount];
+	for(int j = 0; j < BandCount; j++) {
+		values[j] = in;
+	}
+
+	for(int s = 0; s < SectionCount; s++) {
+		SectionCoefficients& c = _sections[s];
+		SectionState& st = state[s];
+		for(int j = 0; j < BandCount; j++) {
+			double x = values[j];
+			double y = c.B[0][j] * x
+				+ c.B[1][j] * st.In[0][j] - c.A[1][j] * st.Out[0][j]
+				+ c.B[2][j] * st.In[1][j] - c.A[2][j] * st.Out[1][j]
+				+ c.B[3][j] * st.In[2][j] - c.A[3][j] * st.Out[2][j]
+				+ c.B[4][j] * st.In[3][j] - c.A[4][j] * st.Out[3][j];
+
+			st.In[3][j] = st.In[2][j];
+			st.In[2][j] = st.In[1][j];
+			st.In[1][j] = st.In[0][j];
+			//Prevent denormalized values (causes extreme performance loss)
+			st.In[0][j] = std::abs(x) < 0.000000000001 ? 0.0 : x;
+
+			st.Out[3][j] = st.Out[2][j];
+			st.Out[2][j] = st.Out[1][j];
+			st.Out[1][j] = st.Out[0][j];
+			y = std::abs(y) < 0.000000000001 ? 0.0 : y;
+			st.Out[0][j] = y;
+
+			values[j] = y;
+		}
+	}
+
+	double out = 0;
+	for(int j = 0; j < BandCount; j++) {
+		out += values[j];
+	}
+	return out;
+}
+
 void Equalizer::ApplyEqualizer(uint32_t sampleCount, int16_t *samples)
 {
-	double outL, outR;
 	for(uint32_t i = 0; i < sampleCount; i++) {
-		double inL = samples[i * 2];
-		double inR = samples[i * 2 + 1];
-			
-		_equalizerLeft->sbs_process(&inL, &outL);
-		_equalizerRight->sbs_process(&inR, &outR);
-
-		samples[i * 2] = (int16_t)std::max(std::min(outL, 32767.0), -32768.0);
-		samples[i * 2 + 1] = (int16_t)std::max(std::min(outR, 32767.0), -32768.0);
+		double outL = ProcessSample(_state[0], samples[i * 2]);
+		double outR = ProcessSample(_state[1], samples[i * 2 + 1]);
+
+		samples[i * 2] = (int16_t)std::clamp(outL, -32768.0, 32767.0);
+		samples[i * 2 + 1] = (int16_t)std::clamp(outR, -32768.0, 32767.0);
 	}
 }
 
-void Equalizer::UpdateEqualizers(vector<double> bandGains, uint32_t sampleRate)
+void Equalizer::UpdateEqualizers(const std::array<double, BandCount>& bandGains, uint32_t sampleRate)
 {
-	if(_prevSampleRate != sampleRate || memcmp(bandGains.data(), _prevEqualizerGains.data(), bandGains.size() * sizeof(double)) != 0) {
-		vector<double> bands = { 40, 56, 80, 113, 160, 225, 320, 450, 600, 750, 1000, 2000, 3000, 4000, 5000, 6000, 7000, 10000, 12500, 13000 };
-		bands.insert(bands.begin(), bands[0] - (bands[1] - bands[0]));
-		bands.insert(bands.end(), bands[bands.size() - 1] + (bands[bands.size() - 1] - bands[bands.size() - 2]));
-
-		_eqFrequencyGrid.reset(new orfanidis_eq::freq_grid());
-		for(size_t i = 1; i < bands.size() - 1; i++) {
-			_eqFrequencyGrid->add_band((bands[i] + bands[i - 1]) / 2, bands[i], (bands[i + 1] + bands[i]) / 2);
-		}
+	if(_prevSampleRate == sampleRate && bandGains == _prevEqualizerGains) {
+		return;
+	}
 
-		_equalizerLeft.reset(new orfanidis_eq::eq1(_eqFrequencyGrid.get(), orfanidis_eq::filter_type::butterworth));
-		_equalizerRight.reset(new orfanidis_eq::eq1(_eqFrequencyGrid.get(), orfanidis_eq::filter_type::butterworth));
-		_equalizerLeft->set_sample_rate(sampleRate);
-		_equalizerRight->set_sample_rate(sampleRate);
+	double bands[BandCount + 2] = { 0, 40, 56, 80, 113, 160, 225, 320, 450, 600, 750, 1000, 2000, 3000, 4000, 5000, 6000, 7000, 10000, 12500, 13000, 0 };
+	bands[0] = bands[1] - (bands[2] - bands[1]);
+	bands[BandCount + 1] = bands[BandCount] + (bands[BandCount] - bands[BandCount - 1]);
 
-		for(unsigned int i = 0; i < _eqFrequencyGrid->get_number_of_bands(); i++) {
-			_equalizerLeft->change_band_gain_db(i, bandGains[i]);
-			_equalizerRight->change_band_gain_db(i, bandGains[i]);
-		}
+	orfanidis_eq::conversions conv(orfanidis_eq::eq_min_max_gain_db);
+
+	for(int j = 0; j < BandCount; j++) {
+		double minFreq = (bands[j + 1] + bands[j]) / 2;
+		double centerFreq = bands[j + 1];
+		double maxFreq = (bands[j + 2] + bands[j + 1]) / 2;
 
-		_prevSampleRate = sampleRate;
-		_prevEqualizerGains = bandGains;
+		orfanidis_eq::butterworth_bp_filter filter(
+			orfanidis_eq::default_eq_band_filters_order,
+			orfanidis_eq::conversions::hz_2_rad(centerFreq, sampleRate),
+			orfanidis_eq::conversions::hz_2_rad(maxFreq - minFreq, sampleRate),
+			orfanidis_eq::max_base_gain_db,
+			orfanidis_eq::butterworth_band_gain_db,
+			orfanidis_eq::min_base_gain_db
+		);
+
+		const vector<orfanidis_eq::fo_section>& sections = filter.get_sections();
+		for(int s = 0; s < SectionCount; s++) {
+			double b[5] = { 1, 0, 0, 0, 0 };
+			double a[5] = { 1, 0, 0, 0, 0 };
+			if(s < (int)sections.size()) {
+				sections[s].get_coefficients(b, a);
+			}
+
+			//The band's gain is applied to the output of the last section (the filters are linear, so scaling
+			//the numerator coefficients gives the same result as multiplying the output by the gain)
+			double gain = s == SectionCount - 1 ? conv.fast_db_2_lin(bandGains[j]) : 1.0;
+			for(int k = 0; k < 5; k++) {
+				_sections[s].B[k][j] = b[k] * gain;
+				_sections[s].A[k][j] = a[k];
+			}
+		}
 	}
+
+	memset(_state, 0, sizeof(_state));
+
+	_prevSampleRate = sampleRate;
+	_prevEqualizerGains = bandGains;
 }
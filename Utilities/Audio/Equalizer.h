@@ -1,18 +1,39 @@
 #pragma once
 #include "pch.h"
-#include "orfanidis_eq.h"
+#include <array>
 
 class Equalizer
 {
+public:
+	static constexpr int BandCount = 20;
+
 private:
-	unique_ptr<orfanidis_eq::freq_grid> _eqFrequencyGrid;
-	unique_ptr<orfanidis_eq::eq1> _equalizerLeft;
-	unique_ptr<orfanidis_eq::eq1> _equalizerRight;
+	//Each band is a 4th order butterworth bandpass filter, made of 2 4th order sections in series
+	static constexpr int SectionCount = 2;
+
+	//Coefficients/state are stored per section as arrays of all bands (structure of arrays),
+	//which allows the compiler to process all bands for a sample with SIMD instructions
+	struct SectionCoefficients
+	{
+		alignas(32) double B[5][BandCount];
+		alignas(32) double A[5][BandCount];
+	};
+
+	struct SectionState
+	{
+		alignas(32) double In[4][BandCount];
+		alignas(32) double Out[4][BandCount];
+	};
+
+	SectionCoefficients _sections[SectionCount] = {};
+	SectionState _state[2][SectionCount] = {};
 
 	uint32_t _prevSampleRate = 0;
-	vector<double> _prevEqualizerGains;
+	std::array<double, BandCount> _prevEqualizerGains = {};
+
+	double ProcessSample(SectionState* state, double in);
 
 public:
 	void ApplyEqualizer(uint32_t sampleCount, int16_t *samples);
-	void UpdateEqualizers(vector<double> bandGains, uint32_t sampleRate);
-};
\ No newline at end of file
+	void UpdateEqualizers(const std::array<double, BandCount>& bandGains, uint32_t sampleRate);
+};
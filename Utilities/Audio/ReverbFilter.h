@@ -1,13 +1,35 @@
 #pragma once
 #include "pch.h"
-#include <deque>
 
 class ReverbDelay
 {
 private:
-	std::deque<int16_t> _samples;
+	//Ring buffer of the mono samples waiting to be mixed back in (only grows when a larger delay/buffer is needed)
+	vector<int16_t> _samples;
+	size_t _readPos = 0;
+	size_t _count = 0;
 	uint32_t _delay = 0;
 	double _decay = 0;
+	int32_t _decayFactor = 0;
+
+	void Reserve(size_t size)
+	{
+		if(size <= _samples.size()) {
+			return;
+		}
+
+		size_t newSize = std::max<size_t>(_samples.size(), 0x1000);
+		while(newSize < size) {
+			newSize *= 2;
+		}
+
+		vector<int16_t> samples(newSize);
+		for(size_t i = 0; i < _count; i++) {
+			samples[i] = _samples[(_readPos + i) & (_samples.size() - 1)];
+		}
+		_samples = std::move(samples);
+		_readPos = 0;
+	}
 
 public:
 	void SetParameters(double delay, double decay, int32_t sampleRate)
@@ -16,31 +38,39 @@ public:
 		if(delaySampleCount != _delay || decay != _decay) {
 			_delay = delaySampleCount;
 			_decay = decay;
-			_samples.clear();
+			_decayFactor = (int32_t)(decay * 65536);
+			Reset();
 		}
 	}
 
 	void Reset()
 	{
-		_samples.clear();
+		_readPos = 0;
+		_count = 0;
 	}
 
 	void AddSamples(int16_t* buffer, size_t sampleCount)
 	{
+		Reserve(_count + sampleCount);
+		size_t mask = _samples.size() - 1;
+		size_t writePos = _readPos + _count;
 		for(size_t i = 0; i < sampleCount; i++) {
-			_samples.push_back(buffer[i*2]);
+			_samples[(writePos + i) & mask] = buffer[i*2];
 		}
+		_count += sampleCount;
 	}
 
 	void ApplyReverb(int16_t* buffer, size_t sampleCount)
 	{
-		if(_samples.size() > _delay) {
-			size_t samplesToInsert = std::min<size_t>(_samples.size() - _delay, sampleCount);
+		if(_count > _delay) {
+			size_t samplesToInsert = std::min<size_t>(_count - _delay, sampleCount);
+			size_t mask = _samples.size() - 1;
 
 			for(size_t j = sampleCount - samplesToInsert; j < sampleCount; j++) {
-				buffer[j*2] += (int16_t)((double)_samples.front() * _decay);
-				_samples.pop_front();
+				buffer[j*2] += (int16_t)((_samples[_readPos] * _decayFactor) >> 16);
+				_readPos = (_readPos + 1) & mask;
 			}
+			_count -= samplesToInsert;
 		}
 	}
 };
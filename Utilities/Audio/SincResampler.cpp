@@ -0,0 +1,214 @@
+#include "pch.h"
+#include "SincResampler.h"
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define MESEN_SINC_SSE
+#endif
+
+SincResampler::SincResampler()
+{
+	Reset();
+}
+
+void SincResampler::Reset()
+{
+	for(int ch = 0; ch < 2; ch++) {
+		_input[ch].clear();
+		_input[ch].resize(_tapCount, 0.0f);
+	}
+	_position = 0;
+}
+
+void SincResampler::SetTapCount(uint32_t tapCount)
+{
+	tapCount = tapCount <= 16 ? 16 : MaxTapCount;
+	if(_tapCount != tapCount) {
+		_tapCount = tapCount;
+		_cutoff = 0;
+		Reset();
+		UpdateKernel();
+	}
+}
+
+void SincResampler::SetVolume(double volume)
+{
+	_volume = (int32_t)(volume * 256);
+}
+
+void SincResampler::SetSampleRates(double srcRate, double dstRate)
+{
+	_rateRatio = srcRate / dstRate;
+	UpdateKernel();
+}
+
+void SincResampler::UpdateKernel()
+{
+	//Cut off slightly below the output's (or input's, when upsampling) nyquist frequency to leave room for the transition band
+	double cutoff = std::min(1.0, 1.0 / _rateRatio) * (_tapCount >= 32 ? 0.92 : 0.85);
+
+	//The dynamic rate control only changes the ratio by a fraction of a percent, don't rebuild the table for these
+	if(_cutoff > 0 && std::abs(cutoff - _cutoff) / _cutoff < 0.01) {
+		return;
+	}
+	_cutoff = cutoff;
+
+	constexpr double pi = 3.14159265358979323846;
+	double beta = _tapCount >= 32 ? 9.0 : 7.0;
+
+	auto besselI0 = [](double x) {
+		double sum = 1.0;
+		double term = 1.0;
+		for(int k = 1; k < 32; k++) {
+			term *= (x / (2 * k)) * (x / (2 * k));
+			sum += term;
+		}
+		return sum;
+	};
+	double i0Beta = besselI0(beta);
+
+	_kernel.resize((PhaseCount + 1) * _tapCount);
+	int32_t halfTaps = _tapCount / 2;
+	for(uint32_t phase = 0; phase <= PhaseCount; phase++) {
+		double frac = (double)phase / PhaseCount;
+		float* row = &_kernel[phase * _tapCount];
+
+		double sum = 0;
+		for(uint32_t i = 0; i < _tapCount; i++) {
+			//Distance (in input samples) between this tap and the output sample's position
+			double x = (int32_t)i - (halfTaps - 1) - frac;
+			double sinc = x == 0 ? 1.0 : std::sin(pi * x * cutoff) / (pi * x * cutoff);
+			double windowPos = x / halfTaps;
+			double window = std::abs(windowPos) >= 1.0 ? 0.0 : besselI0(beta * std::sqrt(1.0 - windowPos * windowPos)) / i0Beta;
+			double value = sinc * window;
+			row[i] = (float)value;
+			sum += value;
+		}
+
+		//Normalize each phase to unity gain to avoid DC ripple between phases
+		for(uint32_t i = 0; i < _tapCount; i++) {
+			row[i] = (float)(row[i] / sum);
+		}
+	}
+}
+
+template<bool addMode>
+void SincResampler::WriteSample(int16_t* out, uint32_t pos, float left, float right)
+{
+	int32_t l = ((int32_t)std::clamp(left, -32768.0f, 32767.0f) * _volume) >> 8;
+	int32_t r = ((int32_t)std::clamp(right, -32768.0f, 32767.0f) * _volume) >> 8;
+	if(addMode) {
+		l += out[pos];
+		r += out[pos + 1];
+	}
+	out[pos] = (int16_t)std::clamp<int32_t>(l, INT16_MIN, INT16_MAX);
+	out[pos + 1] = (int16_t)std::clamp<int32_t>(r, INT16_MIN, INT16_MAX);
+}
+
+template<bool addMode, uint32_t tapCount>
+uint32_t SincResampler::ProcessSamples(int16_t* out, size_t maxOutSampleCount)
+{
+	float* left = _input[0].data();
+	float* right = _input[1].data();
+	size_t available = _input[0].size();
+
+	uint32_t outPos = 0;
+	while(outPos < maxOutSampleCount) {
+		size_t index = (size_t)_position;
+		if(index + tapCount > available) {
+			break;
+		}
+
+		//Interpolate between the 2 nearest precomputed phases and apply the kernel to both channels
+		double phase = (_position - index) * PhaseCount;
+		uint32_t phaseIndex = (uint32_t)phase;
+		float phaseFrac = (float)(phase - phaseIndex);
+		float* k0 = &_kernel[phaseIndex * tapCount];
+		float* k1 = k0 + tapCount;
+		float* inLeft = left + index;
+		float* inRight = right + index;
+
+#ifdef MESEN_SINC_SSE
+		__m128 frac = _mm_set1_ps(phaseFrac);
+		__m128 accLeft = _mm_setzero_ps();
+		__m128 accRight = _mm_setzero_ps();
+		for(uint32_t i = 0; i < tapCount; i += 4) {
+			__m128 a = _mm_loadu_ps(k0 + i);
+			__m128 k = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(k1 + i), a), frac));
+			accLeft = _mm_add_ps(accLeft, _mm_mul_ps(_mm_loadu_ps(inLeft + i), k));
+			accRight = _mm_add_ps(accRight, _mm_mul_ps(_mm_loadu_ps(inRight + i), k));
+		}
+
+		//Horizontal sums - lanes are [L0+L2, R0+R2, L1+L3, R1+R3] after the first step, then [left, right, ...]
+		//The lanes are summed as (0+2)+(1+3), like the scalar version, so both versions give the same result
+		__m128 sums = _mm_add_ps(_mm_unpacklo_ps(accLeft, accRight), _mm_unpackhi_ps(accLeft, accRight));
+		sums = _mm_add_ps(sums, _mm_movehl_ps(sums, sums));
+		float sumLeft = _mm_cvtss_f32(sums);
+		float sumRight = _mm_cvtss_f32(_mm_shuffle_ps(sums, sums, _MM_SHUFFLE(1, 1, 1, 1)));
+#else
+		float accLeft[4] = {};
+		float accRight[4] = {};
+		for(uint32_t i = 0; i < tapCount; i += 4) {
+			for(uint32_t j = 0; j < 4; j++) {
+				float k = k0[i + j] + (k1[i + j] - k0[i + j]) * phaseFrac;
+				accLeft[j] += inLeft[i + j] * k;
+				accRight[j] += inRight[i + j] * k;
+			}
+		}
+		float sumLeft = (accLeft[0] + accLeft[2]) + (accLeft[1] + accLeft[3]);
+		float sumRight = (accRight[0] + accRight[2]) + (accRight[1] + accRight[3]);
+#endif
+
+		WriteSample<addMode>(out, outPos, sumLeft, sumRight);
+		outPos += 2;
+		_position += _rateRatio;
+	}
+	return outPos;
+}
+
+template<bool addMode>
+uint32_t SincResampler::Resample(int16_t* in, uint32_t inSampleCount, int16_t* out, size_t maxOutSampleCount)
+{
+	if(_kernel.empty()) {
+		UpdateKernel();
+	}
+
+	size_t prevSize = _input[0].size();
+	if(prevSize > 0x20000) {
+		//The output buffer has been too small for a long time, drop the pending samples
+		Reset();
+		prevSize = _input[0].size();
+	}
+
+	//Vectors keep their capacity, so this only allocates until the buffers reach their steady state size
+	_input[0].resize(prevSize + inSampleCount);
+	_input[1].resize(prevSize + inSampleCount);
+	float* left = _input[0].data();
+	float* right = _input[1].data();
+	for(uint32_t i = 0; i < inSampleCount; i++) {
+		left[prevSize + i] = in[i * 2];
+		right[prevSize + i] = in[i * 2 + 1];
+	}
+
+	uint32_t outPos;
+	if(_tapCount == 16) {
+		outPos = ProcessSamples<addMode, 16>(out, maxOutSampleCount * 2);
+	} else {
+		outPos = ProcessSamples<addMode, MaxTapCount>(out, maxOutSampleCount * 2);
+	}
+
+	//Discard the samples that are no longer needed (keeps the samples the next output sample needs as history)
+	size_t consumed = std::min((size_t)_position, _input[0].size());
+	if(consumed > 0) {
+		for(int ch = 0; ch < 2; ch++) {
+			_input[ch].erase(_input[ch].begin(), _input[ch].begin() + consumed);
+		}
+		_position -= consumed;
+	}
+
+	return outPos / 2;
+}
+
+template uint32_t SincResampler::Resample<true>(int16_t* in, uint32_t inSampleCount, int16_t* out, size_t maxOutSampleCount);
+template uint32_t SincResampler::Resample<false>(int16_t* in, uint32_t inSampleCount, int16_t* out, size_t maxOutSampleCount);
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+#include "pch.h"
+
+//Polyphase windowed-sinc (Kaiser window) resampler
+//The kernel is precomputed for PhaseCount fractional positions and linearly interpolated between
+//adjacent phases, which allows the ratio to change continuously (dynamic rate control) without
+//recalculating the kernel. The inner loop applies the kernel to both channels with SSE when available.
+class SincResampler
+{
+private:
+	static constexpr uint32_t MaxTapCount = 32;
+	static constexpr uint32_t PhaseCount = 256;
+
+	uint32_t _tapCount = 16;
+	double _rateRatio = 1.0;
+	double _cutoff = 0;
+	int32_t _volume = 256;
+
+	//Kernel table, PhaseCount+1 rows of _tapCount coefficients (the last row is used to interpolate the last phase)
+	vector<float> _kernel;
+
+	//Input samples for each channel, the first _tapCount samples are the history kept from the previous call
+	vector<float> _input[2];
+	double _position = 0;
+
+	void UpdateKernel();
+
+	template<bool addMode, uint32_t tapCount>
+	uint32_t ProcessSamples(int16_t* out, size_t maxOutSampleCount);
+
+	template<bool addMode>
+	__forceinline void WriteSample(int16_t* out, uint32_t pos, float left, float right);
+
+public:
+	SincResampler();
+
+	void Reset();
+
+	//Only 16 and 32 taps are supported
+	void SetTapCount(uint32_t tapCount);
+	void SetVolume(double volume);
+	void SetSampleRates(double srcRate, double dstRate);
+
+	template<bool addMode>
+	uint32_t Resample(int16_t* in, uint32_t inSampleCount, int16_t* out, size_t maxOutSampleCount);
+};
\ No newline at end of file
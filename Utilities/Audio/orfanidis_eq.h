@@ -381,6 +381,11 @@ namespace orfanidis_eq {
 			return df1_fo_process(in);
 		}
 
+		void get_coefficients(eq_single_t b[5], eq_single_t a[5]) const {
+			b[0] = b0; b[1] = b1; b[2] = b2; b[3] = b3; b[4] = b4;
+			a[0] = a0; a[1] = a1; a[2] = a2; a[3] = a3; a[4] = a4;
+		}
+
 		virtual fo_section get() {
 			return *this;
 		}
@@ -525,6 +530,8 @@ namespace orfanidis_eq {
 
 		~butterworth_bp_filter() {}
 
+		const std::vector<fo_section>& get_sections() const { return sections_; }
+
 		static eq_single_t compute_bw_gain_db(eq_single_t gain) {
 			eq_single_t bw_gain = 0;
 			if(gain <= -6)
@@ -135,6 +135,13 @@ string FolderUtilities::GetRecentGamesFolder()
 	return folder;
 }
 
+string FolderUtilities::GetRewindFolder()
+{
+	string folder = CombinePath(GetHomeFolder(), "Rewind");
+	CreateFolder(folder);
+	return folder;
+}
+
 string FolderUtilities::GetExtension(string filename)
 {
 	size_t position = filename.find_last_of('.');
@@ -225,6 +232,22 @@ string FolderUtilities::GetFolderName(string filepath)
 	return fs::u8path(filepath).remove_filename().u8string();
 }
 
+bool FolderUtilities::GetFileInfo(string filepath, uint64_t& size, int64_t& modifiedTime)
+{
+	std::error_code errorCode;
+	fs::path path = fs::u8path(filepath);
+	size = (uint64_t)fs::file_size(path, errorCode);
+	if(errorCode) {
+		return false;
+	}
+	fs::file_time_type time = fs::last_write_time(path, errorCode);
+	if(errorCode) {
+		return false;
+	}
+	modifiedTime = (int64_t)time.time_since_epoch().count();
+	return true;
+}
+
 string FolderUtilities::CombinePath(string folder, string filename)
 {
 	//Windows supports forward slashes for paths, too.  And fs::u8path is abnormally slow.
@@ -29,6 +29,7 @@ public:
 	static string GetHdPackFolder();
 	static string GetDebuggerFolder();
 	static string GetRecentGamesFolder();
+	static string GetRewindFolder();
 
 	static vector<string> GetFolders(string rootFolder);
 	static vector<string> GetFilesInFolder(string rootFolder, std::unordered_set<string> extensions, bool recursive);
@@ -36,6 +37,7 @@ public:
 	static string GetFilename(string filepath, bool includeExtension);
 	static string GetExtension(string filename);
 	static string GetFolderName(string filepath);
+	static bool GetFileInfo(string filepath, uint64_t& size, int64_t& modifiedTime);
 
 	static void CreateFolder(string folder);
 
@@ -27,8 +27,17 @@ namespace utf8 {
 		ofstream() : std::ofstream() { }
 		void open(const std::string& _Str, ios_base::openmode _Mode = ios_base::in, int _Prot = (int)ios_base::_Openprot) { std::ofstream::open(utf8::decode(_Str), _Mode, _Prot); }
 	};
+
+	class fstream : public std::fstream
+	{
+	public:
+		fstream(const std::string& _Str, ios_base::openmode _Mode = ios_base::in | ios_base::out, int _Prot = (int)ios_base::_Openprot) : std::fstream(utf8::decode(_Str), _Mode, _Prot) { }
+		fstream() : std::fstream() { }
+		void open(const std::string& _Str, ios_base::openmode _Mode = ios_base::in | ios_base::out, int _Prot = (int)ios_base::_Openprot) { std::fstream::open(utf8::decode(_Str), _Mode, _Prot); }
+	};
 #else
 	using std::ifstream;
 	using std::ofstream;
+	using std::fstream;
 #endif
 }
\ No newline at end of file
@@ -200,10 +200,8 @@ void Renderer::ResetTextureBuffers()
 		_pTextureSrv = nullptr;
 	}
 
-	delete[] _textureBuffer[0];
-	_textureBuffer[0] = nullptr;
-	delete[] _textureBuffer[1];
-	_textureBuffer[1] = nullptr;
+	_textureBuffer[0].reset();
+	_textureBuffer[1].reset();
 }
 
 void Renderer::ReleaseRenderTargetView()
@@ -248,10 +246,10 @@ HRESULT Renderer::CreateEmuTextureBuffers()
 	vp.TopLeftY = 0;
 	_pDeviceContext->RSSetViewports(1, &vp);
 
-	_textureBuffer[0] = new uint8_t[_emuFrameWidth*_emuFrameHeight * 4];
-	_textureBuffer[1] = new uint8_t[_emuFrameWidth*_emuFrameHeight * 4];
-	memset(_textureBuffer[0], 0, _emuFrameWidth*_emuFrameHeight * 4);
-	memset(_textureBuffer[1], 0, _emuFrameWidth*_emuFrameHeight * 4);
+	_textureBuffer[0] = _bufferPool->Acquire(_emuFrameWidth*_emuFrameHeight);
+	_textureBuffer[1] = _bufferPool->Acquire(_emuFrameWidth*_emuFrameHeight);
+	memset(_textureBuffer[0].get(), 0, _emuFrameWidth*_emuFrameHeight * 4);
+	memset(_textureBuffer[1].get(), 0, _emuFrameWidth*_emuFrameHeight * 4);
 
 	_pTexture = CreateTexture(_emuFrameWidth, _emuFrameHeight);
 	if(!_pTexture) {
@@ -409,7 +407,9 @@ void Renderer::ClearFrame()
 	auto lock = _textureLock.AcquireSafe();
 	if(_textureBuffer[0]) {
 		//_textureBuffer[0] may be null if directx failed to initialize properly
-		memset(_textureBuffer[0], 0, _emuFrameWidth * _emuFrameHeight * sizeof(uint32_t));
+		//The current buffer may be shared with the video filters, clear a buffer of our own instead
+		_textureBuffer[0] = _bufferPool->Acquire(_emuFrameWidth * _emuFrameHeight);
+		memset(_textureBuffer[0].get(), 0, _emuFrameWidth * _emuFrameHeight * sizeof(uint32_t));
 		_needFlip = true;
 		_frameChanged = true;
 	}
@@ -422,7 +422,13 @@ void Renderer::UpdateFrame(RenderedFrame& frame)
 	auto lock = _textureLock.AcquireSafe();
 	if(_textureBuffer[0]) {
 		//_textureBuffer[0] may be null if directx failed to initialize properly
-		memcpy(_textureBuffer[0], frame.FrameBuffer, frame.Width*frame.Height*sizeof(uint32_t));
+		if(frame.BufferHandle) {
+			//Pooled frame, keep a reference to it instead of copying it - it is copied directly into the texture in DrawScreen
+			_textureBuffer[0] = frame.BufferHandle;
+		} else {
+			_textureBuffer[0] = _bufferPool->Acquire(frame.Width * frame.Height);
+			memcpy(_textureBuffer[0].get(), frame.FrameBuffer, frame.Width*frame.Height*sizeof(uint32_t));
+		}
 		_needFlip = true;
 		_frameChanged = true;
 	}
@@ -433,9 +439,7 @@ void Renderer::DrawScreen()
 	//Swap buffers - emulator always writes to _textureBuffer[0], screen always draws _textureBuffer[1]
 	if(_needFlip) {
 		auto lock = _textureLock.AcquireSafe();
-		uint8_t* textureBuffer = _textureBuffer[0];
-		_textureBuffer[0] = _textureBuffer[1];
-		_textureBuffer[1] = textureBuffer;
+		std::swap(_textureBuffer[0], _textureBuffer[1]);
 		_needFlip = false;
 
 		if(_frameChanged) {
@@ -453,7 +457,7 @@ void Renderer::DrawScreen()
 		return;
 	}
 	uint8_t* surfacePointer = (uint8_t*)dd.pData;
-	uint8_t* videoBuffer = _textureBuffer[1];
+	uint8_t* videoBuffer = (uint8_t*)_textureBuffer[1].get();
 	if(rowPitch != dd.RowPitch) {
 		for(uint32_t i = 0, iMax = _emuFrameHeight; i < iMax; i++) {
 			memcpy(surfacePointer, videoBuffer, rowPitch);
@@ -3,6 +3,7 @@
 #include "Common.h"
 #include "Core/Shared/Interfaces/IRenderingDevice.h"
 #include "Core/Shared/Interfaces/IMessageManager.h"
+#include "Core/Shared/Video/FrameBufferPool.h"
 #include "Utilities/FolderUtilities.h"
 #include "Utilities/SimpleLock.h"
 #include "Utilities/Timer.h"
@@ -36,7 +37,8 @@ private:
 	ID3D11RenderTargetView* _pRenderTargetView = nullptr;
 
 	atomic<bool> _needFlip = false;
-	uint8_t* _textureBuffer[2] = { nullptr, nullptr };
+	FrameBufferHandle _textureBuffer[2];
+	shared_ptr<FrameBufferPool> _bufferPool = FrameBufferPool::Create();
 	ID3D11Texture2D* _pTexture = nullptr;
 	ID3D11ShaderResourceView* _pTextureSrv = nullptr;
 